@@ -15,67 +15,268 @@ try:
 except ImportError:
     pass
 
-### TODO: maybe add a 'find_lapack' equivalent
+def _cache_dir():
+    ## Per-user cache folder, following XDG convention when available
+    if "XDG_CACHE_HOME" in os.environ:
+        return os.path.join(os.environ["XDG_CACHE_HOME"], "findblas")
+    return os.path.join(os.path.expanduser("~"), ".cache", "findblas")
+
+
+def _cache_key(*args):
+    ## The key takes the python environment plus any variables that could alter
+    ## the search paths, so that e.g. switching conda environments or modifying
+    ## PATH will not return a stale entry
+    import hashlib
+
+    relevant_env = [
+        "PATH",
+        "PYTHONPATH",
+        "CONDA_PREFIX",
+        "VIRTUAL_ENV",
+        "LD_LIBRARY_PATH",
+        "DYLD_LIBRARY_PATH",
+        "MKLROOT",
+    ]
+    key_parts = [sys.prefix, platform, platform_module.machine()]
+    key_parts += [os.environ.get(e, "") for e in relevant_env]
+    key_parts += [str(a) for a in args]
+    return hashlib.sha256("\x00".join(key_parts).encode()).hexdigest()[:32]
 
 
-def find_blas(allow_unidentified_blas=True, allow_pep518_paths=True):
-    """
-    Find installed BLAS library
+def _load_cached_blas(key):
+    try:
+        import json
+
+        cache_file = os.path.join(_cache_dir(), key + ".json")
+        if not os.path.exists(cache_file):
+            return None
+        with open(cache_file) as f:
+            entry = json.load(f)
+        ## Invalidate if the files moved or were replaced since the cache was written
+        lib_full = os.path.join(entry["blas_path"], entry["blas_file"])
+        if not os.path.exists(lib_full):
+            return None
+        if os.path.getmtime(lib_full) != entry["blas_mtime"]:
+            return None
+        if (entry["incl_path"] is not None) and (entry["incl_file"] is not None):
+            incl_full = os.path.join(entry["incl_path"], entry["incl_file"])
+            if not os.path.exists(incl_full):
+                return None
+            if os.path.getmtime(incl_full) != entry["incl_mtime"]:
+                return None
+        return (
+            entry["blas_path"],
+            entry["blas_file"],
+            entry["incl_path"],
+            entry["incl_file"],
+            entry["flags"],
+        )
+    except Exception:
+        return None
 
-    Find installed BLAS library either through a system install (e.g. by a package manager, CPACK, or downloading installer from intel's webpage),
-    or a python install (e.g. 'conda install mkl mkl-include openblas gsl', 'pip install mkl mkl-include').
 
-    Can find any of: MKL, OpenBLAS, BLIS, ATLAS, GSL - all of which offer the standard CBLAS API (e.g. functions named like 'cblas_dgemm').
+def _store_cached_blas(key, blas_path, blas_file, incl_path, incl_file, flags):
+    try:
+        import json
+
+        cache_fold = _cache_dir()
+        if not os.path.exists(cache_fold):
+            os.makedirs(cache_fold, exist_ok=True)
+        entry = {
+            "blas_path": blas_path,
+            "blas_file": blas_file,
+            "incl_path": incl_path,
+            "incl_file": incl_file,
+            "flags": flags,
+            "blas_mtime": os.path.getmtime(os.path.join(blas_path, blas_file)),
+            "incl_mtime": (
+                os.path.getmtime(os.path.join(incl_path, incl_file))
+                if (incl_path is not None) and (incl_file is not None)
+                else None
+            ),
+        }
+        cache_file = os.path.join(cache_fold, key + ".json")
+        ## Write-then-rename so a concurrent build never reads a half-written file
+        cache_tmp = cache_file + "." + str(os.getpid())
+        with open(cache_tmp, "w") as f:
+            json.dump(entry, f)
+        os.replace(cache_tmp, cache_file)
+    except Exception:
+        pass
 
-    In non-Windows systems, will try to use either 'pyelftools' or system's 'readelf' to inspect the library's functions if the
-    library's file name is generic (e.g. 'libblas.so').
 
-    Does not have any external dependencies, but the following are recommended: numpy, scipy, pyelftools, cython.
+## Inspection cache - memoizes the symbol-scan verdicts ('_find_symbols' and
+## '_probe_optional_symbols') keyed by the file's identity on disk rather than
+## its path. Conda environments often reach the same physical 'libmkl_rt.so'
+## through several symlinked aliases, and without this each alias would pay
+## for the full ELF scan again. Also persisted to disk alongside the discovery
+## cache, so repeated builds with 'FINDBLAS_NO_CACHE' or changed search paths
+## still skip re-inspecting libraries that have not changed.
+_inspection_cache = None
 
-    Parameters
-    ----------
-    allow_unidentified_blas : bool
-        Whether to allow outputting a BLAS library which cannot be identified as being from one of the supported
-        vendors (MKL, OpenBLAS, BLIS, ATLAS, GSL) and on which no standard BLAS function symbols have been found
-        through ELF inspectors.
 
-        Typically, SciPy's shared object files will be considered as candidates to output, and they tend to contain
-        all of the 'reference' BLAS symbols as part of their exported symbols on linux, but on windows systems, the
-        DLLs from SciPy tend not to export BLAS symbols and hence are not linkable for python extensions that require
-        them. Note that this library will only inspect ELF formats, which windows DLLs do not conform to.
+def _file_identity(full_path):
+    ## Follows symlinks, so all aliases of the same physical file get one key
+    try:
+        st = os.stat(full_path)
+        return "%d:%d:%r" % (st.st_dev, st.st_ino, st.st_mtime)
+    except Exception:
+        return None
 
-        If passing 'True', and an unrecognized library has been identified as a candidate, it will ask the user
-        through a command line prompt about whether to take the library or not.
 
-        If passing 'False', will not output an unrecognized and uninspected library, and there will be no user prompt.
-    allow_pep518_paths : bool
-        Whether to also look in temporary paths from a PEP518 build-time environment. Note that these paths will only
-        be available during the setup of a given package, but will be removed afterwards, so having them as a hard-coded
-        path will not be useful for dynamic linking, but can still be useful for other purposes such as static linking
-        or just generically linking against symbols that are guaranteed to be loaded beforehand.
+def _load_inspection_cache():
+    global _inspection_cache
+    if _inspection_cache is None:
+        _inspection_cache = {}
+        try:
+            import json
 
-    Returns
-    -------
-    blas_path : str
-        Path where the BLAS library file is located (e.g. '/usr/local/lib')
-    blas_file : str
-        Name of the file (e.g. 'libblas.so')
-    incl_path : str
-        Path where the corresponding header(s) can be found (e.g. '/usr/include')
-    incl_file : str
-        Name of the header file (e.g. 'cblas-openblas.h')
-    flags : list
-        Potential flags about the library that was found (can e.g. be passed to preprocessor), including:
-        - HAS_MKL (MKL library was found)
-        - HAS_OPENBLAS (OpenBLAS library was found)
-        - HAS_BLIS (BLIS library was found - note that is does not include LAPACK like the others)
-        - HAS_ATLAS (ATLAS library was found)
-        - HAS_GSL (GSL library was found)
-        - UNKNWON_BLAS (Vendor cannot be identified)
-        - NO_CBLAS (found library does not possess CBLAS API)
-        - HAS_UNDERSCORES (found library contains functions with original names ending in underscores, e.g. 'dgemm_').
-    """
+            with open(os.path.join(_cache_dir(), "inspections.json")) as f:
+                _inspection_cache = json.load(f)
+        except Exception:
+            pass
+    return _inspection_cache
+
+
+def _store_inspection_cache():
+    try:
+        import json
+
+        cache_fold = _cache_dir()
+        if not os.path.exists(cache_fold):
+            os.makedirs(cache_fold, exist_ok=True)
+        cache_file = os.path.join(cache_fold, "inspections.json")
+        ## Write-then-rename so a concurrent build never reads a half-written file
+        cache_tmp = cache_file + "." + str(os.getpid())
+        with open(cache_tmp, "w") as f:
+            json.dump(_inspection_cache, f)
+        os.replace(cache_tmp, cache_file)
+    except Exception:
+        pass
+
+
+def _benchmark_blas_candidates(candidates, use_cache=True):
+    ## Times each candidate library through a small 'ctypes' harness - 'dgemm'
+    ## at a few representative sizes for throughput plus 'ddot' at a tiny size
+    ## for call overhead - and returns the fastest one. Results are cached per
+    ## machine (keyed by the candidate files and their mtimes) so the cost is
+    ## paid only once per environment.
+    if len(candidates) == 1:
+        return candidates[0]
+
+    bench_key = None
+    if use_cache:
+        try:
+            import json
+
+            key_parts = []
+            for pt, fname, flags in candidates:
+                full_path = os.path.join(pt, fname)
+                try:
+                    mtime = str(os.path.getmtime(full_path))
+                except Exception:
+                    ## e.g. Accelerate, whose binary may exist only inside the
+                    ## dyld shared cache rather than on the filesystem
+                    mtime = "-"
+                key_parts += [full_path, mtime]
+            bench_key = "bench-" + _cache_key(*key_parts)
+            with open(os.path.join(_cache_dir(), bench_key + ".json")) as f:
+                entry = json.load(f)
+            if 0 <= entry["winner"] < len(candidates):
+                return candidates[entry["winner"]]
+        except Exception:
+            pass
+
+    ## Each candidate runs in its own subprocess: the integer arguments have to
+    ## be sized to the candidate's interface ('c_longlong' for ILP64 builds -
+    ## an ILP64 library reading 64-bit dimensions out of 32-bit-initialized
+    ## registers is undefined behavior), and a library that still crashes on
+    ## call (broken install, wrong ABI) would otherwise take the parent - i.e.
+    ## the ongoing 'pip install' - down with it, since a segfault inside a
+    ## 'ctypes' call is not a catchable exception.
+    bench_harness = """
+import ctypes, sys, time
+c_int = ctypes.c_longlong if (sys.argv[2] == "1") else ctypes.c_int
+lib = ctypes.CDLL(sys.argv[1])
+ddot = lib.cblas_ddot
+ddot.restype = ctypes.c_double
+dgemm = lib.cblas_dgemm
+
+## call overhead: many repetitions of a tiny ddot
+n_small = 8
+x = (ctypes.c_double * n_small)(*([1.0] * n_small))
+one_i = c_int(1)
+ddot(c_int(n_small), x, one_i, x, one_i)
+t0 = time.perf_counter()
+for _ in range(2000):
+    ddot(c_int(n_small), x, one_i, x, one_i)
+elapsed = time.perf_counter() - t0
+
+## throughput: square dgemm at a couple of representative sizes
+one = ctypes.c_double(1.0)
+zero = ctypes.c_double(0.0)
+for sz in (64, 256):
+    A = (ctypes.c_double * (sz * sz))()
+    C = (ctypes.c_double * (sz * sz))()
+    szi = c_int(sz)
+    dgemm(101, 111, 111, szi, szi, szi, one, A, szi, A, szi, zero, C, szi)
+    n_reps = 5
+    t0 = time.perf_counter()
+    for _ in range(n_reps):
+        dgemm(101, 111, 111, szi, szi, szi, one, A, szi, A, szi, zero, C, szi)
+    elapsed += (time.perf_counter() - t0) / n_reps
+print(repr(elapsed))
+"""
+
+    def time_candidate(full_path, c_flags):
+        import subprocess
+
+        outp = subprocess.check_output(
+            [
+                sys.executable,
+                "-c",
+                bench_harness,
+                full_path,
+                "1" if ("BLAS_ILP64" in c_flags) else "0",
+            ],
+            stderr=subprocess.DEVNULL,
+            timeout=600,
+        )
+        return float(outp.strip())
+
+    timings = []
+    for pt, fname, flags in candidates:
+        try:
+            timings.append(time_candidate(os.path.join(pt, fname), flags))
+        except Exception:
+            ## candidate could not be loaded, is missing the cblas symbols,
+            ## or crashed/hung in the subprocess
+            timings.append(float("inf"))
+
+    best = min(range(len(candidates)), key=lambda ix: timings[ix])
+    if timings[best] == float("inf"):
+        return None
+
+    if use_cache and (bench_key is not None):
+        try:
+            import json
 
+            cache_fold = _cache_dir()
+            if not os.path.exists(cache_fold):
+                os.makedirs(cache_fold, exist_ok=True)
+            with open(os.path.join(cache_fold, bench_key + ".json"), "w") as f:
+                json.dump({"winner": best, "timings": timings}, f)
+        except Exception:
+            pass
+
+    return candidates[best]
+
+
+def _build_search_space(allow_pep518_paths=True, prefer_static=False):
+    ## Everything 'find_blas()' needs before it can start testing candidates:
+    ## the per-vendor file-name lists, the deduplicated search paths, and the
+    ## per-vendor include-folder hints. Shared with 'find_all_blas()', which
+    ## walks the same space lazily
     if platform[:3] == "win":
         ext = [".lib", ".dll", ".dll.a", ".a"]
         pref = ""
@@ -86,6 +287,13 @@ def find_blas(allow_unidentified_blas=True, allow_pep518_paths=True):
         ext = [".so", ".a"]
         pref = "lib"
 
+    ## When asked to prefer static libraries, swap the extension priority so
+    ## that the two rounds of the search cascade below ('file_names1' then
+    ## 'file_names2') try the '.a' candidates first (on Windows the '.lib'
+    ## files come first already)
+    if prefer_static and (platform[:3] != "win"):
+        ext = [ext[1], ext[0]]
+
     ## Possible file names for each library in different OSes
     ## Tries to look for dynamic-link libraries at first, but in MSVC, linking to the .dll's will fail
     mkl_file_names1 = process_fnames1(["mkl_rt", "mkl_rt.2", "mkl_rt.1"], pref, ext[0])
@@ -93,6 +301,23 @@ def find_blas(allow_unidentified_blas=True, allow_pep518_paths=True):
     blis_file_names1 = process_fnames1(["blis", "blis-mt"], pref, ext[0])
     atlas_file_names1 = process_fnames1(["atlas", "tatlas", "satlas"], pref, ext[0])
     gsl_file_names1 = process_fnames1(["gslcblas"], pref, ext[0])
+    ## ARM Performance Libraries and NVIDIA NVPL (aarch64 only) - the
+    ## multi-threaded/LP64 builds first, matching the other vendors' defaults
+    armpl_file_names1 = process_fnames1(
+        ["armpl_lp64_mp", "armpl_lp64", "armpl_ilp64_mp", "armpl_ilp64", "armpl"],
+        pref,
+        ext[0],
+    )
+    nvpl_file_names1 = process_fnames1(
+        [
+            "nvpl_blas_lp64_gomp",
+            "nvpl_blas_lp64_seq",
+            "nvpl_blas_ilp64_gomp",
+            "nvpl_blas_ilp64_seq",
+        ],
+        pref,
+        ext[0],
+    )
 
     if platform[:3] == "win":
         add_windows_fnames1 = lambda lst: [nm + ext[2] for nm in lst]
@@ -106,12 +331,29 @@ def find_blas(allow_unidentified_blas=True, allow_pep518_paths=True):
     blis_file_names2 = process_fnames1(["blis", "blis-mt"], pref, ext[1])
     atlas_file_names2 = process_fnames1(["atlas", "tatlas", "satlas"], pref, ext[1])
     gsl_file_names2 = process_fnames1(["gslcblas"], pref, ext[1])
+    armpl_file_names2 = process_fnames1(
+        ["armpl_lp64_mp", "armpl_lp64", "armpl_ilp64_mp", "armpl_ilp64", "armpl"],
+        pref,
+        ext[1],
+    )
+    nvpl_file_names2 = process_fnames1(
+        [
+            "nvpl_blas_lp64_gomp",
+            "nvpl_blas_lp64_seq",
+            "nvpl_blas_ilp64_gomp",
+            "nvpl_blas_ilp64_seq",
+        ],
+        pref,
+        ext[1],
+    )
 
     incl_mkl_name = ["mkl.h", "mkl_cblas.h", "mkl_blas.h"]
     incl_openblas_name = ["cblas-openblas.h"]
     incl_blis_name = ["blis.h"]
     incl_atlas_name = []
     incl_gsl_name = ["gsl_cblas.h", "gsl_blas.h"]
+    incl_armpl_name = ["armpl.h"]
+    incl_nvpl_name = ["nvpl_blas.h", "nvpl_blas_cblas.h"]
     incl_generic_name = ["cblas.h", "blas.h"]
 
     ## Will look up each potential file name in folders:
@@ -128,6 +370,8 @@ def find_blas(allow_unidentified_blas=True, allow_pep518_paths=True):
     blis_include_paths = []
     atlas_include_paths = []
     gsl_include_paths = []
+    armpl_include_paths = []
+    nvpl_include_paths = []
     system_include_paths = []
 
     # sys.stdout = open(os.devnull, "w")
@@ -416,6 +660,30 @@ def find_blas(allow_unidentified_blas=True, allow_pep518_paths=True):
                         candidate_paths.append(os.path.join(dd, "lib"))
                         blis_include_paths.append(os.path.join(dd, "amd-blis"))
 
+        ## ArmPL does the same under /opt/arm (the environment modules also
+        ## export ARMPL_DIR), and NVPL installs under /opt/nvidia
+        if "ARMPL_DIR" in os.environ:
+            candidate_paths.append(os.path.join(os.environ["ARMPL_DIR"], "lib"))
+            armpl_include_paths.append(
+                os.path.join(os.environ["ARMPL_DIR"], "include")
+            )
+        arm_hardcoded_paths = ["/opt/arm/"]
+        for pt in arm_hardcoded_paths:
+            if os.path.exists(pt):
+                for d in os.listdir(pt):
+                    dd = os.path.join(pt, d)
+                    if os.path.isdir(dd) and bool(re.search("armpl", d)):
+                        candidate_paths.append(os.path.join(dd, "lib"))
+                        armpl_include_paths.append(os.path.join(dd, "include"))
+        candidate_paths += ["/opt/nvidia/nvpl/lib"]
+        nvpl_include_paths += ["/opt/nvidia/nvpl/include"]
+
+        ## the distro packages of both land in the multiarch folder, which the
+        ## hard-coded list below only covers for x86
+        if platform_module.machine() in ("aarch64", "arm64"):
+            candidate_paths += ["/usr/lib/aarch64-linux-gnu"]
+            system_include_paths += ["/usr/include/aarch64-linux-gnu"]
+
         mkl_include_paths += [
             "/opt/intel/include",
             "/opt/intel/mkl/include",
@@ -851,6 +1119,289 @@ def find_blas(allow_unidentified_blas=True, allow_pep518_paths=True):
     ## Discard duplicated paths, but keep the order
     search_paths = _deduplicate_paths(candidate_paths)
 
+    return {
+        "pref": pref,
+        "ext": ext,
+        "search_paths": search_paths,
+        "mkl_file_names1": mkl_file_names1,
+        "openblas_file_names1": openblas_file_names1,
+        "blis_file_names1": blis_file_names1,
+        "atlas_file_names1": atlas_file_names1,
+        "gsl_file_names1": gsl_file_names1,
+        "armpl_file_names1": armpl_file_names1,
+        "nvpl_file_names1": nvpl_file_names1,
+        "mkl_file_names2": mkl_file_names2,
+        "openblas_file_names2": openblas_file_names2,
+        "blis_file_names2": blis_file_names2,
+        "atlas_file_names2": atlas_file_names2,
+        "gsl_file_names2": gsl_file_names2,
+        "armpl_file_names2": armpl_file_names2,
+        "nvpl_file_names2": nvpl_file_names2,
+        "incl_mkl_name": incl_mkl_name,
+        "incl_openblas_name": incl_openblas_name,
+        "incl_blis_name": incl_blis_name,
+        "incl_atlas_name": incl_atlas_name,
+        "incl_gsl_name": incl_gsl_name,
+        "incl_armpl_name": incl_armpl_name,
+        "incl_nvpl_name": incl_nvpl_name,
+        "incl_generic_name": incl_generic_name,
+        "mkl_include_paths": mkl_include_paths,
+        "openblas_include_paths": openblas_include_paths,
+        "blis_include_paths": blis_include_paths,
+        "atlas_include_paths": atlas_include_paths,
+        "gsl_include_paths": gsl_include_paths,
+        "armpl_include_paths": armpl_include_paths,
+        "nvpl_include_paths": nvpl_include_paths,
+        "system_include_paths": system_include_paths,
+    }
+
+
+def _find_blas_from_env(library, include):
+    ## Resolves the 'FINDBLAS_LIBRARY' / 'FINDBLAS_INCLUDE' override: the given
+    ## library file is taken as-is with no filesystem search, and only a
+    ## lightweight symbol inspection runs against it to derive the flags
+    library = os.path.expanduser(library)
+    if not os.path.isfile(library):
+        raise ValueError(
+            "Environment variable 'FINDBLAS_LIBRARY' points to a non-existent file: "
+            + library
+        )
+    blas_path, blas_file = os.path.split(os.path.abspath(library))
+
+    flags_found = []
+    if platform[:3] != "win":
+        found_syms = _find_symbols(blas_path, blas_file)
+        if (found_syms[0] is True) and (found_syms[1] is not None):
+            flags_found += found_syms[1]
+
+    if not any(bool(re.search("^HAS_", f)) for f in flags_found):
+        ## the vendor marker symbols were inconclusive (or the file cannot be
+        ## inspected, e.g. windows DLLs) - infer the vendor from the file name,
+        ## same naming patterns the regular search goes by
+        for vendor_flag, patt, extra_flags in [
+            ("HAS_MKL", "mkl", []),
+            ("HAS_OPENBLAS", "openblas", ["HAS_UNDERSCORES"]),
+            ("HAS_BLIS", "blis", ["HAS_UNDERSCORES"]),
+            ("HAS_ATLAS", "atlas", ["HAS_UNDERSCORES"]),
+            ("HAS_GSL", "gsl", []),
+            ("HAS_ARMPL", "armpl", ["HAS_UNDERSCORES"]),
+            ("HAS_NVPL", "nvpl", ["HAS_UNDERSCORES"]),
+        ]:
+            if bool(re.search(patt, blas_file)):
+                flags_found.append(vendor_flag)
+                flags_found += [f for f in extra_flags if f not in flags_found]
+                break
+        else:
+            flags_found.append("UNKNWON_BLAS")
+    if ("BLAS_ILP64" not in flags_found) and (
+        bool(re.search("openblas64", blas_file)) or bool(re.search("ilp64", blas_file))
+    ):
+        flags_found.append("BLAS_ILP64")
+
+    all_optional_syms = sorted(
+        set(s for flag, syms in _optional_symbol_registry for s in syms)
+    )
+    found_optional = _probe_optional_symbols(blas_path, blas_file, all_optional_syms)
+    for flag, syms in _optional_symbol_registry:
+        if (flag not in flags_found) and all(s in found_optional for s in syms):
+            flags_found.append(flag)
+
+    incl_path = None
+    incl_file = None
+    if include != "":
+        include = os.path.expanduser(include)
+        if os.path.isfile(include):
+            incl_path, incl_file = os.path.split(os.path.abspath(include))
+        elif os.path.isdir(include):
+            incl_path = os.path.abspath(include)
+            for f in [
+                "mkl_cblas.h",
+                "mkl_blas.h",
+                "cblas-openblas.h",
+                "armpl.h",
+                "nvpl_blas_cblas.h",
+                "nvpl_blas.h",
+                "gsl_cblas.h",
+                "cblas.h",
+                "blas.h",
+            ]:
+                if os.path.exists(os.path.join(incl_path, f)):
+                    incl_file = f
+                    break
+        else:
+            raise ValueError(
+                "Environment variable 'FINDBLAS_INCLUDE' points to a non-existent path: "
+                + include
+            )
+
+    return blas_path, blas_file, incl_path, incl_file, flags_found
+
+
+def find_blas(
+    allow_unidentified_blas=True,
+    allow_pep518_paths=True,
+    use_cache=True,
+    select="first",
+    prefer_static=False,
+):
+    """
+    Find installed BLAS library
+
+    Find installed BLAS library either through a system install (e.g. by a package manager, CPACK, or downloading installer from intel's webpage),
+    or a python install (e.g. 'conda install mkl mkl-include openblas gsl', 'pip install mkl mkl-include').
+
+    Can find any of: MKL, OpenBLAS, BLIS, ATLAS, GSL - all of which offer the standard CBLAS API (e.g. functions named like 'cblas_dgemm').
+
+    In non-Windows systems, will try to use either 'pyelftools' or system's 'readelf' to inspect the library's functions if the
+    library's file name is generic (e.g. 'libblas.so').
+
+    Does not have any external dependencies, but the following are recommended: numpy, scipy, pyelftools, cython.
+
+    The search can be bypassed altogether by setting environment variable 'FINDBLAS_LIBRARY' to the path of the
+    library file to link (and optionally 'FINDBLAS_INCLUDE' to its header file or include directory), in which case
+    only a lightweight symbol inspection of that single file is performed to derive the flags - intended for
+    deployment images and hermetic builds where the BLAS is known in advance and the linkage must be deterministic.
+
+    Parameters
+    ----------
+    allow_unidentified_blas : bool
+        Whether to allow outputting a BLAS library which cannot be identified as being from one of the supported
+        vendors (MKL, OpenBLAS, BLIS, ATLAS, GSL) and on which no standard BLAS function symbols have been found
+        through ELF inspectors.
+
+        Typically, SciPy's shared object files will be considered as candidates to output, and they tend to contain
+        all of the 'reference' BLAS symbols as part of their exported symbols on linux, but on windows systems, the
+        DLLs from SciPy tend not to export BLAS symbols and hence are not linkable for python extensions that require
+        them. Note that this library will only inspect ELF formats, which windows DLLs do not conform to.
+
+        If passing 'True', and an unrecognized library has been identified as a candidate, it will ask the user
+        through a command line prompt about whether to take the library or not.
+
+        If passing 'False', will not output an unrecognized and uninspected library, and there will be no user prompt.
+    allow_pep518_paths : bool
+        Whether to also look in temporary paths from a PEP518 build-time environment. Note that these paths will only
+        be available during the setup of a given package, but will be removed afterwards, so having them as a hard-coded
+        path will not be useful for dynamic linking, but can still be useful for other purposes such as static linking
+        or just generically linking against symbols that are guaranteed to be loaded beforehand.
+    use_cache : bool
+        Whether to cache the result on disk (under '~/.cache/findblas' or equivalent) and reuse it on repeated
+        calls from the same environment, which avoids re-running the full filesystem search and library inspection
+        on every build. The cache is keyed by the python installation and relevant environment variables, and is
+        invalidated automatically when the files that were found change on disk. Can also be disabled by setting
+        environment variable 'FINDBLAS_NO_CACHE'.
+    select : str
+        How to choose when more than one BLAS library is installed. With 'first' (the default), returns the
+        first hit in the usual hard-coded search order (MKL, OpenBLAS, BLIS, ATLAS, GSL). With 'fastest', will
+        instead collect one candidate per vendor, time each of them with a small benchmark ('dgemm' at a few
+        representative sizes plus 'ddot' for call overhead), and return the measured winner - e.g. on AMD CPUs
+        this typically avoids picking a slower MKL over BLIS/OpenBLAS. The measurements are cached per machine
+        so the benchmark only runs once per environment.
+    prefer_static : bool
+        Whether to prefer static libraries ('.a') over shared ones when both are installed - intended for
+        deliberate static linking (e.g. to enable '-flto' across the BLAS boundary and avoid PLT indirection
+        on small calls). Note that linking a static BLAS typically requires also linking its dependencies
+        (e.g. '-lgfortran -lpthread' for OpenBLAS), which the 'build_ext_with_blas' class will add
+        automatically when used with environment variable 'FINDBLAS_STATIC_BLAS'. Has no effect on Windows,
+        where the '.lib' files are already preferred.
+
+    Returns
+    -------
+    blas_path : str
+        Path where the BLAS library file is located (e.g. '/usr/local/lib')
+    blas_file : str
+        Name of the file (e.g. 'libblas.so')
+    incl_path : str
+        Path where the corresponding header(s) can be found (e.g. '/usr/include')
+    incl_file : str
+        Name of the header file (e.g. 'cblas-openblas.h')
+    flags : list
+        Potential flags about the library that was found (can e.g. be passed to preprocessor), including:
+        - HAS_MKL (MKL library was found)
+        - HAS_OPENBLAS (OpenBLAS library was found)
+        - HAS_BLIS (BLIS library was found - note that is does not include LAPACK like the others)
+        - HAS_ATLAS (ATLAS library was found)
+        - HAS_GSL (GSL library was found)
+        - HAS_ARMPL (ARM Performance Libraries were found - aarch64 only)
+        - HAS_NVPL (NVIDIA Performance Libraries' BLAS was found - aarch64 only)
+        - HAS_ACCELERATE (Apple's Accelerate framework was found - macOS only; link with
+          '-framework Accelerate', which 'build_ext_with_blas' does automatically)
+        - ACCELERATE_NEW_LAPACK (Accelerate provides the modern '$NEWLAPACK' interface (macOS >= 13.3),
+          which is much faster than its classic symbols - passed as-is to Apple's headers)
+        - UNKNWON_BLAS (Vendor cannot be identified)
+        - NO_CBLAS (found library does not possess CBLAS API)
+        - HAS_UNDERSCORES (found library contains functions with original names ending in underscores, e.g. 'dgemm_').
+        - BLAS_ILP64 (found library uses 64-bit integers for indices and dimensions, e.g. 'libopenblas64_.so').
+        - HAS_BATCHED_GEMM (found library provides 'cblas_?gemm_batch' entry points).
+        - HAS_BATCHED_GEMM_STRIDED (found library provides 'cblas_?gemm_batch_strided' entry points).
+        - HAS_CBLAS_GEMM3M (found library provides 'cblas_?gemm3m' entry points).
+        - HAS_CBLAS_AXPBY (found library provides 'cblas_?axpby' entry points).
+        - HAS_CBLAS_IMATCOPY (found library provides 'cblas_?imatcopy' entry points).
+        - HAS_CBLAS_OMATCOPY (found library provides 'cblas_?omatcopy' entry points).
+        - HAS_CBLAS_SDSDOT (found library provides 'cblas_sdsdot'/'cblas_dsdot' entry points).
+        - HAS_SPARSE_BLAS (found library provides a sparse BLAS API - MKL's inspector-executor
+          entry points ('mkl_sparse_*') or ArmPL's sparse API ('armpl_spmat_*') - "findblas.h"
+          gates the corresponding prototypes on it through the 'FINDBLAS_HAS_SPARSE' macro).
+        - FINDBLAS_FALLBACK (no library was found at all and environment variable 'FINDBLAS_FALLBACK' was
+          set - the other four return values will be 'None', and 'build_ext_with_blas' will compile the
+          slow reference kernels bundled with this package into the extension instead of linking a BLAS).
+    """
+
+    assert select in ("first", "fastest")
+
+    ### Environment override: deployment images that already know which BLAS
+    ### they carry can pin it directly and skip the whole search pipeline -
+    ### only a lightweight symbol inspection runs against the given file, which
+    ### also makes the linkage deterministic when e.g. both a system and a
+    ### conda library are installed
+    if os.environ.get("FINDBLAS_LIBRARY", "") != "":
+        return _find_blas_from_env(
+            os.environ["FINDBLAS_LIBRARY"], os.environ.get("FINDBLAS_INCLUDE", "")
+        )
+
+    use_cache = use_cache and ("FINDBLAS_NO_CACHE" not in os.environ)
+    if use_cache:
+        cache_key = _cache_key(
+            allow_unidentified_blas, allow_pep518_paths, select, prefer_static
+        )
+        cached = _load_cached_blas(cache_key)
+        if cached is not None:
+            return cached
+
+    space = _build_search_space(allow_pep518_paths, prefer_static)
+    pref = space["pref"]
+    ext = space["ext"]
+    search_paths = space["search_paths"]
+    mkl_file_names1 = space["mkl_file_names1"]
+    openblas_file_names1 = space["openblas_file_names1"]
+    blis_file_names1 = space["blis_file_names1"]
+    atlas_file_names1 = space["atlas_file_names1"]
+    gsl_file_names1 = space["gsl_file_names1"]
+    armpl_file_names1 = space["armpl_file_names1"]
+    nvpl_file_names1 = space["nvpl_file_names1"]
+    mkl_file_names2 = space["mkl_file_names2"]
+    openblas_file_names2 = space["openblas_file_names2"]
+    blis_file_names2 = space["blis_file_names2"]
+    atlas_file_names2 = space["atlas_file_names2"]
+    gsl_file_names2 = space["gsl_file_names2"]
+    armpl_file_names2 = space["armpl_file_names2"]
+    nvpl_file_names2 = space["nvpl_file_names2"]
+    incl_mkl_name = space["incl_mkl_name"]
+    incl_openblas_name = space["incl_openblas_name"]
+    incl_blis_name = space["incl_blis_name"]
+    incl_atlas_name = space["incl_atlas_name"]
+    incl_gsl_name = space["incl_gsl_name"]
+    incl_armpl_name = space["incl_armpl_name"]
+    incl_nvpl_name = space["incl_nvpl_name"]
+    incl_generic_name = space["incl_generic_name"]
+    mkl_include_paths = space["mkl_include_paths"]
+    openblas_include_paths = space["openblas_include_paths"]
+    blis_include_paths = space["blis_include_paths"]
+    atlas_include_paths = space["atlas_include_paths"]
+    gsl_include_paths = space["gsl_include_paths"]
+    armpl_include_paths = space["armpl_include_paths"]
+    nvpl_include_paths = space["nvpl_include_paths"]
+    system_include_paths = space["system_include_paths"]
+
     flags_found = list()
     blas_file = None
     blas_path = None
@@ -863,18 +1414,86 @@ def find_blas(allow_unidentified_blas=True, allow_pep518_paths=True):
                 search_paths_new += [pt + s for pt in search_paths]
             search_paths = search_paths_new
 
-        blas_path = None
-        blas_file = None
-        for blas_name in blas_names:
-            if blas_file is None:
-                for pt in search_paths:
-                    if os.path.exists(os.path.join(pt, blas_name)):
-                        blas_file = blas_name
-                        blas_path = pt
-                        break
-            else:
-                break
-        return blas_path, blas_file
+        ## Check all the combinations concurrently, but keep the original
+        ## priority order (file names first, then paths) when picking the result
+        candidates = [
+            (blas_name, pt) for blas_name in blas_names for pt in search_paths
+        ]
+        existing = _exists_parallel(
+            [os.path.join(pt, blas_name) for blas_name, pt in candidates]
+        )
+        for blas_name, pt in candidates:
+            if os.path.join(pt, blas_name) in existing:
+                return pt, blas_name
+        return None, None
+
+    ### Benchmark arbitration: collect one candidate per vendor and take the
+    ### measured winner instead of the first hit in the hard-coded order
+    if select == "fastest":
+        vendor_searches = [
+            ("HAS_MKL", mkl_file_names1, None, []),
+            ("HAS_ARMPL", armpl_file_names1, None, ["HAS_UNDERSCORES"]),
+            ("HAS_NVPL", nvpl_file_names1, None, ["HAS_UNDERSCORES"]),
+            (
+                "HAS_OPENBLAS",
+                openblas_file_names1,
+                ["openblas", "openblas-openmp", "openblas-pthread", "openblas-serial"],
+                ["HAS_UNDERSCORES"],
+            ),
+            (
+                "HAS_BLIS",
+                blis_file_names1,
+                ["blis", "blis-openmp", "blis-pthread", "blis-serial"],
+                ["HAS_UNDERSCORES"],
+            ),
+            ("HAS_ATLAS", atlas_file_names1, None, ["HAS_UNDERSCORES"]),
+            ("HAS_GSL", gsl_file_names1, None, []),
+        ]
+        candidates = []
+        for vendor_flag, file_names, suff, extra_flags in vendor_searches:
+            c_path, c_file = search_blas_lib(search_paths, file_names, suff)
+            if c_file is not None:
+                c_flags = [vendor_flag] + extra_flags
+                if bool(re.search("openblas64", c_file)) or bool(
+                    re.search("ilp64", c_file)
+                ):
+                    c_flags.append("BLAS_ILP64")
+                candidates.append((c_path, c_file, c_flags))
+        ## on Apple Silicon the Accelerate framework competes too - its
+        ## AMX-backed gemm usually wins, but it has to be measured like the
+        ## rest (its binary loads fine through 'ctypes' even when the dyld
+        ## shared cache keeps it off the filesystem)
+        if (platform[:3] == "dar") and (platform_module.machine() == "arm64"):
+            accelerate_path = _find_accelerate()
+            if accelerate_path is not None:
+                candidates.insert(
+                    0,
+                    (
+                        accelerate_path,
+                        "Accelerate",
+                        ["HAS_ACCELERATE", "HAS_UNDERSCORES"]
+                        + _accelerate_newlapack_flags(),
+                    ),
+                )
+        if len(candidates):
+            winner = _benchmark_blas_candidates(candidates, use_cache)
+            if winner is not None:
+                blas_path, blas_file = winner[0], winner[1]
+                flags_found += winner[2]
+
+    ### Apple's Accelerate framework - checked first on Apple Silicon, where its
+    ### AMX-backed gemm outruns anything installable through conda/pip
+    if (
+        (blas_file is None)
+        and (platform[:3] == "dar")
+        and (platform_module.machine() == "arm64")
+    ):
+        accelerate_path = _find_accelerate()
+        if accelerate_path is not None:
+            blas_path = accelerate_path
+            blas_file = "Accelerate"
+            flags_found += ["HAS_ACCELERATE", "HAS_UNDERSCORES"]
+            flags_found += _accelerate_newlapack_flags()
 
     ### First try dynamic-link libraries
     ## MKL
@@ -883,6 +1502,25 @@ def find_blas(allow_unidentified_blas=True, allow_pep518_paths=True):
         if blas_file is not None:
             flags_found.append("HAS_MKL")
 
+    ## ArmPL - before OpenBLAS, since on the machines where it exists at all
+    ## (aarch64) its SVE kernels beat the distro OpenBLAS builds
+    if blas_file is None:
+        blas_path, blas_file = search_blas_lib(search_paths, armpl_file_names1)
+        if blas_file is not None:
+            flags_found.append("HAS_ARMPL")
+            flags_found.append("HAS_UNDERSCORES")
+            if bool(re.search("ilp64", blas_file)):
+                flags_found.append("BLAS_ILP64")
+
+    ## NVPL
+    if blas_file is None:
+        blas_path, blas_file = search_blas_lib(search_paths, nvpl_file_names1)
+        if blas_file is not None:
+            flags_found.append("HAS_NVPL")
+            flags_found.append("HAS_UNDERSCORES")
+            if bool(re.search("ilp64", blas_file)):
+                flags_found.append("BLAS_ILP64")
+
     ## OpenBLAS
     if blas_file is None:
         blas_path, blas_file = search_blas_lib(
@@ -893,6 +1531,8 @@ def find_blas(allow_unidentified_blas=True, allow_pep518_paths=True):
         if blas_file is not None:
             flags_found.append("HAS_OPENBLAS")
             flags_found.append("HAS_UNDERSCORES")
+            if bool(re.search("openblas64", blas_file)):
+                flags_found.append("BLAS_ILP64")
 
     ## BLIS
     if blas_file is None:
@@ -925,6 +1565,24 @@ def find_blas(allow_unidentified_blas=True, allow_pep518_paths=True):
         if blas_file is not None:
             flags_found.append("HAS_MKL")
 
+    ## ArmPL
+    if blas_file is None:
+        blas_path, blas_file = search_blas_lib(search_paths, armpl_file_names2)
+        if blas_file is not None:
+            flags_found.append("HAS_ARMPL")
+            flags_found.append("HAS_UNDERSCORES")
+            if bool(re.search("ilp64", blas_file)):
+                flags_found.append("BLAS_ILP64")
+
+    ## NVPL
+    if blas_file is None:
+        blas_path, blas_file = search_blas_lib(search_paths, nvpl_file_names2)
+        if blas_file is not None:
+            flags_found.append("HAS_NVPL")
+            flags_found.append("HAS_UNDERSCORES")
+            if bool(re.search("ilp64", blas_file)):
+                flags_found.append("BLAS_ILP64")
+
     ## OpenBLAS
     if blas_file is None:
         blas_path, blas_file = search_blas_lib(
@@ -960,6 +1618,16 @@ def find_blas(allow_unidentified_blas=True, allow_pep518_paths=True):
         if blas_file is not None:
             flags_found.append("HAS_GSL")
 
+    ## Accelerate on Intel macs - only after the installable vendors, which
+    ## tend to be faster than the framework there
+    if (blas_file is None) and (platform[:3] == "dar"):
+        accelerate_path = _find_accelerate()
+        if accelerate_path is not None:
+            blas_path = accelerate_path
+            blas_file = "Accelerate"
+            flags_found += ["HAS_ACCELERATE", "HAS_UNDERSCORES"]
+            flags_found += _accelerate_newlapack_flags()
+
     ### Generic
     if blas_file is None:
         blas_path, blas_file = search_blas_lib(
@@ -1047,7 +1715,7 @@ def find_blas(allow_unidentified_blas=True, allow_pep518_paths=True):
                 flags_found += temp
                 break
 
-    err_msg = "Could not locate MKL, OpenBLAS, BLIS, ATLAS or GSL libraries - you'll need to manually modify setup.py to add BLAS path."
+    err_msg = "Could not locate MKL, OpenBLAS, BLIS, ATLAS, GSL, ArmPL or NVPL libraries - you'll need to manually modify setup.py to add BLAS path."
     if blas_file is None:
         try:
             import numpy as np
@@ -1089,8 +1757,32 @@ def find_blas(allow_unidentified_blas=True, allow_pep518_paths=True):
                 )
 
             except Exception:
+                ## last resort: if the user opted into it, hand back the bundled
+                ## reference kernels ('rtd_mock.c') instead of failing outright -
+                ## 'build_ext_with_blas' compiles them into the extension when it
+                ## sees this flag, same as it does for ReadTheDocs builds
+                if os.environ.get("FINDBLAS_FALLBACK", "") != "":
+                    warnings.warn(
+                        "No BLAS library found - will compile the unoptimized fallback kernels bundled with findblas."
+                    )
+                    return None, None, None, None, ["FINDBLAS_FALLBACK"]
                 raise ValueError(err_msg)
 
+    ### Check which optional vendor entry points (batched gemm, gemm3m, axpby,
+    ### imatcopy/omatcopy, sdsdot) the found library actually provides - the
+    ### headers gate the corresponding prototypes on these flags and provide
+    ### composed-call fallbacks for the ones that are absent
+    if (blas_path is not None) and (blas_file is not None):
+        all_optional_syms = sorted(
+            set(s for flag, syms in _optional_symbol_registry for s in syms)
+        )
+        found_optional = _probe_optional_symbols(
+            blas_path, blas_file, all_optional_syms
+        )
+        for flag, syms in _optional_symbol_registry:
+            if (flag not in flags_found) and all(s in found_optional for s in syms):
+                flags_found.append(flag)
+
     ### Now lookup the include path
     def get_inc_paths(blas_path, include_paths, system_include_paths):
         include_paths += [
@@ -1105,11 +1797,18 @@ def find_blas(allow_unidentified_blas=True, allow_pep518_paths=True):
     def search_incl_kwds(search_paths, blas_names, keywords):
         incl_file = None
         incl_path = None
+        existing = _exists_parallel(
+            [
+                os.path.join(pt, incl_name)
+                for incl_name in blas_names
+                for pt in search_paths
+            ]
+        )
         for incl_name in blas_names:
             for pt in search_paths:
                 if incl_file is not None:
                     break
-                if os.path.exists(os.path.join(pt, incl_name)):
+                if os.path.join(pt, incl_name) in existing:
                     with open(os.path.join(pt, incl_name)) as h:
                         for line in h:
                             if incl_file is not None:
@@ -1158,6 +1857,28 @@ def find_blas(allow_unidentified_blas=True, allow_pep518_paths=True):
             search_paths, incl_gsl_name + incl_generic_name, ["GSL_CBLAS"]
         )
 
+    elif "HAS_ARMPL" in flags_found:
+        search_paths = get_inc_paths(
+            blas_path, armpl_include_paths, system_include_paths
+        )
+        incl_path, incl_file = search_incl_kwds(
+            search_paths, incl_armpl_name + incl_generic_name, ["armpl", "ARMPL"]
+        )
+
+    elif "HAS_NVPL" in flags_found:
+        search_paths = get_inc_paths(
+            blas_path, nvpl_include_paths, system_include_paths
+        )
+        incl_path, incl_file = search_incl_kwds(
+            search_paths, incl_nvpl_name + incl_generic_name, ["nvpl", "NVPL"]
+        )
+
+    elif "HAS_ACCELERATE" in flags_found:
+        ## the framework carries its own headers - '-framework Accelerate' at
+        ## link time plus '#include <Accelerate/Accelerate.h>' covers them, so
+        ## there is no separate header file to look for
+        pass
+
     else:
         flags_found.append("UNKNWON_BLAS")
         search_paths = get_inc_paths(blas_path, [], system_include_paths)
@@ -1169,9 +1890,524 @@ def find_blas(allow_unidentified_blas=True, allow_pep518_paths=True):
             search_paths, incl_generic_name, all_kwds
         )
 
+    if use_cache and (blas_path is not None) and (blas_file is not None):
+        _store_cached_blas(
+            cache_key, blas_path, blas_file, incl_path, incl_file, flags_found
+        )
+
     return blas_path, blas_file, incl_path, incl_file, flags_found
 
 
+def find_all_blas(allow_pep518_paths=True):
+    """
+    Enumerate every installed BLAS library, lazily, in search-priority order
+
+    Walks the same search space as 'find_blas' but as a generator yielding every
+    candidate instead of stopping at the first one - intended for multi-backend
+    dispatch tooling and for benchmark arbitration, where the complete set is
+    wanted without re-running discovery per library.
+
+    Candidates are produced lazily: existence checks happen as the generator is
+    advanced, and the expensive ELF inspection of generically-named files (e.g.
+    'libblas.so') is only paid when such a candidate is about to be yielded, so
+    callers that stop at the first hit pay near-zero cost. Unlike 'find_blas',
+    there is no interactive prompt - generically-named files whose symbols
+    cannot be verified are skipped. Each physical library is yielded only once,
+    even when several symlinked paths reach it.
+
+    Parameters
+    ----------
+    allow_pep518_paths : bool
+        Whether to also look in temporary paths from a PEP518 build-time environment
+        (see 'find_blas' for caveats).
+
+    Yields
+    ------
+    candidate : tuple(str, str, str, list)
+        Tuples of (path, file, vendor, flags), where vendor is one of 'mkl',
+        'armpl', 'nvpl', 'openblas', 'blis', 'atlas', 'gsl', 'accelerate',
+        'unknown', and flags carries the same entries 'find_blas' would emit
+        for that library (vendor flag, 'HAS_UNDERSCORES', 'BLAS_ILP64', etc.).
+    """
+    space = _build_search_space(allow_pep518_paths, False)
+    search_paths = space["search_paths"]
+    pref = space["pref"]
+    ext = space["ext"]
+    seen = set()
+
+    def emit(pt, fname, vendor, flags):
+        ## dedupe by file identity, so symlinked aliases only come out once
+        ident = _file_identity(os.path.join(pt, fname))
+        if ident is None:
+            ident = os.path.join(pt, fname)
+        if ident in seen:
+            return None
+        seen.add(ident)
+        return pt, fname, vendor, flags
+
+    def iter_existing(file_names, suff=None):
+        ## same priority as 'search_blas_lib' (file names first, then paths),
+        ## but checking existence one candidate at a time instead of batching
+        paths = search_paths
+        if suff is not None:
+            paths = deepcopy(search_paths)
+            for s in suff:
+                paths += [pt + s for pt in search_paths]
+        for fname in file_names:
+            for pt in paths:
+                if os.path.exists(os.path.join(pt, fname)):
+                    yield pt, fname
+
+    def name_flags(vendor_flag, extra_flags, fname):
+        flags = [vendor_flag] + extra_flags
+        if bool(re.search("openblas64", fname)) or bool(re.search("ilp64", fname)):
+            flags.append("BLAS_ILP64")
+        return flags
+
+    openblas_suff = ["openblas", "openblas-openmp", "openblas-pthread", "openblas-serial"]
+    blis_suff = ["blis", "blis-openmp", "blis-pthread", "blis-serial"]
+    vendor_rounds = [
+        ("mkl", "HAS_MKL", space["mkl_file_names1"], None, []),
+        ("armpl", "HAS_ARMPL", space["armpl_file_names1"], None, ["HAS_UNDERSCORES"]),
+        ("nvpl", "HAS_NVPL", space["nvpl_file_names1"], None, ["HAS_UNDERSCORES"]),
+        ("openblas", "HAS_OPENBLAS", space["openblas_file_names1"], openblas_suff, ["HAS_UNDERSCORES"]),
+        ("blis", "HAS_BLIS", space["blis_file_names1"], blis_suff, ["HAS_UNDERSCORES"]),
+        ("atlas", "HAS_ATLAS", space["atlas_file_names1"], None, ["HAS_UNDERSCORES"]),
+        ("gsl", "HAS_GSL", space["gsl_file_names1"], None, []),
+        ("mkl", "HAS_MKL", space["mkl_file_names2"], None, []),
+        ("armpl", "HAS_ARMPL", space["armpl_file_names2"], None, ["HAS_UNDERSCORES"]),
+        ("nvpl", "HAS_NVPL", space["nvpl_file_names2"], None, ["HAS_UNDERSCORES"]),
+        ("openblas", "HAS_OPENBLAS", space["openblas_file_names2"], openblas_suff, ["HAS_UNDERSCORES"]),
+        ("blis", "HAS_BLIS", space["blis_file_names2"], blis_suff, ["HAS_UNDERSCORES"]),
+        ("atlas", "HAS_ATLAS", space["atlas_file_names2"], None, ["HAS_UNDERSCORES"]),
+        ("gsl", "HAS_GSL", space["gsl_file_names2"], None, []),
+    ]
+
+    ## Accelerate keeps its place from the 'find_blas' cascade: ahead of
+    ## everything on Apple Silicon, after the installable vendors otherwise
+    accelerate_emitted = False
+    if (platform[:3] == "dar") and (platform_module.machine() == "arm64"):
+        accelerate_path = _find_accelerate()
+        if accelerate_path is not None:
+            flags = ["HAS_ACCELERATE", "HAS_UNDERSCORES"] + _accelerate_newlapack_flags()
+            res = emit(accelerate_path, "Accelerate", "accelerate", flags)
+            accelerate_emitted = True
+            if res is not None:
+                yield res
+
+    for vendor, vendor_flag, file_names, suff, extra_flags in vendor_rounds:
+        for pt, fname in iter_existing(file_names, suff):
+            res = emit(pt, fname, vendor, name_flags(vendor_flag, extra_flags, fname))
+            if res is not None:
+                yield res
+
+    if (platform[:3] == "dar") and not accelerate_emitted:
+        accelerate_path = _find_accelerate()
+        if accelerate_path is not None:
+            flags = ["HAS_ACCELERATE", "HAS_UNDERSCORES"] + _accelerate_newlapack_flags()
+            res = emit(accelerate_path, "Accelerate", "accelerate", flags)
+            if res is not None:
+                yield res
+
+    ## Generically-named files - vendor and flags can only come from symbol
+    ## inspection, which is deferred to the moment the candidate comes up
+    def inspect_and_emit(pt, fname):
+        if platform[:3] == "win":
+            return None
+        found_syms = _find_symbols(pt, fname)
+        if (found_syms[0] is not True) or (found_syms[1] is None):
+            return None
+        flags = list(found_syms[1])
+        vendor = "unknown"
+        for v_flag, v_name in [
+            ("HAS_MKL", "mkl"),
+            ("HAS_OPENBLAS", "openblas"),
+            ("HAS_BLIS", "blis"),
+            ("HAS_ARMPL", "armpl"),
+            ("HAS_NVPL", "nvpl"),
+        ]:
+            if v_flag in flags:
+                vendor = v_name
+                break
+        if vendor == "unknown":
+            flags.append("UNKNWON_BLAS")
+        return emit(pt, fname, vendor, flags)
+
+    generic_names = [pref + "cblas" + e for e in ext]
+    generic_names += [pref + "blas" + e for e in ext]
+    generic_names += [pref + "BLAS" + e for e in ext]
+    for pt, fname in iter_existing(generic_names):
+        res = inspect_and_emit(pt, fname)
+        if res is not None:
+            yield res
+
+    ## last, anything whose name merely matches 'blas' - same net the regex
+    ## stage of 'find_blas' casts, minus the interactive prompt
+    for e in ext:
+        for pt in search_paths:
+            try:
+                folder_files = os.listdir(pt)
+            except Exception:
+                continue
+            for fname in folder_files:
+                if bool(re.search("blas", fname)) and bool(
+                    re.search(r"\." + e[1:] + r"$", fname)
+                ):
+                    res = inspect_and_emit(pt, fname)
+                    if res is not None:
+                        yield res
+
+
+def find_lapack(allow_pep518_paths=True, use_cache=True):
+    """
+    Find installed LAPACK library
+
+    Companion to 'find_blas' for locating a LAPACK/LAPACKE library. Since most distributions bundle LAPACK
+    in the same shared object as BLAS (MKL's 'mkl_rt', OpenBLAS, ATLAS), will first run the BLAS search and
+    inspect its result for LAPACK symbols, and only then look for a separate library file (e.g. 'liblapack.so',
+    'liblapacke.so', or BLIS's split 'libflame').
+
+    Parameters
+    ----------
+    allow_pep518_paths : bool
+        Whether to also look in temporary paths from a PEP518 build-time environment (see 'find_blas').
+    use_cache : bool
+        Whether to cache the result on disk and reuse it on repeated calls from the same environment
+        (see 'find_blas').
+
+    Returns
+    -------
+    lapack_path : str
+        Path where the LAPACK library file is located (e.g. '/usr/local/lib')
+    lapack_file : str
+        Name of the file (e.g. 'liblapack.so')
+    incl_path : str
+        Path where the corresponding header(s) can be found, if any were found (e.g. '/usr/include')
+    incl_file : str
+        Name of the header file, if any was found (e.g. 'lapacke.h')
+    flags : list
+        Potential flags about the library that was found (can e.g. be passed to preprocessor), including:
+        - HAS_MKL / HAS_OPENBLAS / HAS_ATLAS (LAPACK comes bundled in the corresponding BLAS library)
+        - HAS_FLAME (found BLIS's companion 'libflame')
+        - HAS_LAPACKE (found library possesses the LAPACKE C interface)
+        - LAPACK_ILP64 (found library uses 64-bit integers for indices and dimensions)
+        - HAS_UNDERSCORES (found library contains functions with names ending in underscores, e.g. 'dpotrf_')
+        - UNKNOWN_LAPACK (file matched by name but its symbols could not be inspected)
+    """
+    use_cache = use_cache and ("FINDBLAS_NO_CACHE" not in os.environ)
+    if use_cache:
+        cache_key = _cache_key("lapack", allow_pep518_paths)
+        cached = _load_cached_blas(cache_key)
+        if cached is not None:
+            return cached
+
+    lapack_syms = [
+        "dpotrf_",
+        "LAPACKE_dpotrf",
+        "dpotrf",
+        "DPOTRF",
+        "dpotrf_64_",
+    ]
+
+    def inspect_lapack(pt, fname):
+        ## Returns identification flags when the file contains LAPACK symbols,
+        ## 'None' when it clearly does not, and 'UNKNOWN_LAPACK' when it could
+        ## not be inspected (e.g. static libraries, windows DLLs)
+        found = _probe_optional_symbols(pt, fname, lapack_syms)
+        if not len(found):
+            if platform[:3] == "win":
+                return ["UNKNOWN_LAPACK"]
+            if _scan_elf_strtabs(os.path.join(pt, fname), ["dpotrf_"]) is None:
+                return ["UNKNOWN_LAPACK"]
+            return None
+        flags = []
+        if "dpotrf_" in found:
+            flags.append("HAS_UNDERSCORES")
+        if "LAPACKE_dpotrf" in found:
+            flags.append("HAS_LAPACKE")
+        if ("dpotrf_64_" in found) and ("dpotrf_" not in found):
+            flags.append("LAPACK_ILP64")
+        return flags
+
+    flags_found = []
+    lapack_path = None
+    lapack_file = None
+    blas_path = None
+    blas_file = None
+    blas_flags = []
+    try:
+        blas_path, blas_file, _, _, blas_flags = find_blas(
+            allow_unidentified_blas=False,
+            allow_pep518_paths=allow_pep518_paths,
+            use_cache=use_cache,
+        )
+    except Exception:
+        pass
+
+    ## Most distributions bundle LAPACK in the same library as BLAS
+    ## (note that BLIS does not, as it puts LAPACK in a separate 'libflame')
+    if (blas_file is not None) and ("HAS_BLIS" not in blas_flags):
+        res = inspect_lapack(blas_path, blas_file)
+        if (res is not None) and ("UNKNOWN_LAPACK" not in res):
+            lapack_path, lapack_file = blas_path, blas_file
+            flags_found = [
+                f
+                for f in blas_flags
+                if f in ("HAS_MKL", "HAS_OPENBLAS", "HAS_ATLAS")
+            ] + res
+
+    ## Otherwise look for a separate library file
+    if lapack_file is None:
+        if platform[:3] == "win":
+            ext = [".lib", ".dll.a", ".a"]
+            pref = ""
+        elif platform[:3] == "dar":
+            ext = [".dylib", ".a"]
+            pref = "lib"
+        else:
+            ext = [".so", ".a"]
+            pref = "lib"
+        lapack_names = []
+        for e in ext:
+            lapack_names += [
+                pref + "lapacke" + e,
+                pref + "lapack" + e,
+                pref + "flame" + e,
+            ]
+        if platform[:3] not in ("win", "dar"):
+            lapack_names += ["liblapacke.so.3", "liblapack.so.3"]
+
+        search_paths = []
+        if blas_path is not None:
+            search_paths.append(blas_path)
+        search_paths.append(os.path.join(sys.prefix, "lib"))
+        if platform[:3] == "win":
+            search_paths.append(os.path.join(sys.prefix, "Library", "bin"))
+            search_paths.append(os.path.join(sys.prefix, "Library", "lib"))
+        _try_add_from_command(
+            "os.environ['LD_LIBRARY_PATH'].split(\":\")", search_paths
+        )
+        sys_arch = platform_module.architecture()[0][:2]
+        if platform[:3] != "win":
+            search_paths += [
+                "/usr/lib/x86"
+                + ("_" if sys_arch == "64" else "")
+                + sys_arch
+                + "-linux-gnu",
+                "/usr/lib",
+                "/usr/local/lib",
+                "/lib64",
+                "/lib",
+                "/usr/lib64",
+                "/usr/local/lib64",
+                "/opt/local/lib64",
+                "/opt/local/lib",
+                "/usr/lib64/atlas",
+                "/usr/lib/atlas",
+            ]
+        search_paths = _deduplicate_paths(search_paths)
+
+        candidates = [(nm, pt) for nm in lapack_names for pt in search_paths]
+        existing = _exists_parallel(
+            [os.path.join(pt, nm) for nm, pt in candidates]
+        )
+        for nm, pt in candidates:
+            if os.path.join(pt, nm) not in existing:
+                continue
+            res = inspect_lapack(pt, nm)
+            if res is None:
+                continue
+            lapack_path, lapack_file = pt, nm
+            flags_found += res
+            if bool(re.search("flame", nm)):
+                flags_found.append("HAS_FLAME")
+            break
+
+    if lapack_file is None:
+        raise ValueError(
+            "Could not locate a LAPACK library - you'll need to manually modify setup.py to add LAPACK path."
+        )
+
+    ### Now lookup the include path
+    incl_path = None
+    incl_file = None
+    if "HAS_MKL" in flags_found:
+        incl_names = ["mkl.h", "mkl_lapacke.h", "mkl_lapack.h"]
+    else:
+        incl_names = ["lapacke.h", "lapack.h", "clapack.h"]
+    incl_search_paths = [
+        lapack_path,
+        re.sub("/lib.?$", "/include", lapack_path),
+        re.sub(r"^(.*)/lib/(.*)$", r"\1/include/\2", lapack_path),
+        os.path.join(sys.prefix, "include"),
+    ]
+    if platform[:3] == "win":
+        incl_search_paths.append(os.path.join(sys.prefix, "Library", "include"))
+    else:
+        sys_arch = platform_module.architecture()[0][:2]
+        incl_search_paths += [
+            "/usr/include/x86"
+            + ("_" if sys_arch == "64" else "")
+            + sys_arch
+            + "-linux-gnu",
+            "/usr/include",
+            "/usr/local/include",
+            "/opt/local/include",
+        ]
+    incl_search_paths = _deduplicate_paths(incl_search_paths)
+    incl_candidates = [(nm, pt) for nm in incl_names for pt in incl_search_paths]
+    existing = _exists_parallel(
+        [os.path.join(pt, nm) for nm, pt in incl_candidates]
+    )
+    for nm, pt in incl_candidates:
+        if os.path.join(pt, nm) in existing:
+            incl_path, incl_file = pt, nm
+            break
+
+    if use_cache:
+        _store_cached_blas(
+            cache_key, lapack_path, lapack_file, incl_path, incl_file, flags_found
+        )
+
+    return lapack_path, lapack_file, incl_path, incl_file, flags_found
+
+
+## Optional vendor entry points to probe in the found library - maps the flag
+## to emit to the symbols that must all be present for it. The findblas headers
+## gate the corresponding prototypes on these flags (with composed-call
+## fallbacks for absent ones), so extensions can take the fast paths safely.
+## A flag may appear in more than one row when different vendors spell the
+## same capability differently (e.g. sparse BLAS) - any fully-matching row
+## emits it.
+_optional_symbol_registry = [
+    ("HAS_BATCHED_GEMM", ["cblas_dgemm_batch", "cblas_sgemm_batch"]),
+    (
+        "HAS_BATCHED_GEMM_STRIDED",
+        ["cblas_dgemm_batch_strided", "cblas_sgemm_batch_strided"],
+    ),
+    ("HAS_CBLAS_GEMM3M", ["cblas_cgemm3m", "cblas_zgemm3m"]),
+    (
+        "HAS_CBLAS_AXPBY",
+        ["cblas_saxpby", "cblas_daxpby", "cblas_caxpby", "cblas_zaxpby"],
+    ),
+    (
+        "HAS_CBLAS_IMATCOPY",
+        ["cblas_simatcopy", "cblas_dimatcopy", "cblas_cimatcopy", "cblas_zimatcopy"],
+    ),
+    (
+        "HAS_CBLAS_OMATCOPY",
+        ["cblas_somatcopy", "cblas_domatcopy", "cblas_comatcopy", "cblas_zomatcopy"],
+    ),
+    ("HAS_CBLAS_SDSDOT", ["cblas_sdsdot", "cblas_dsdot"]),
+    ## MKL's inspector-executor sparse API
+    ("HAS_SPARSE_BLAS", ["mkl_sparse_d_create_csr", "mkl_sparse_d_mm"]),
+    ## ArmPL's sparse API
+    ("HAS_SPARSE_BLAS", ["armpl_spmat_create_csr_d", "armpl_spmm_exec_d"]),
+]
+
+
+def _probe_optional_symbols(pt, fname, symbol_names):
+    ## Memoized by file identity through the inspection cache - see
+    ## '_find_symbols' for the rationale
+    ident = _file_identity(os.path.join(pt, fname))
+    if ident is None:
+        return _probe_optional_symbols_uncached(pt, fname, symbol_names)
+    key = "optional|" + ident + "|" + ",".join(sorted(symbol_names))
+    cache = _load_inspection_cache()
+    if key not in cache:
+        cache[key] = sorted(
+            _probe_optional_symbols_uncached(pt, fname, symbol_names)
+        )
+        _store_inspection_cache()
+    return set(cache[key])
+
+
+def _probe_optional_symbols_uncached(pt, fname, symbol_names):
+    ## Checks which of the given optional entry points (vendor extensions such
+    ## as the batched-gemm API) exist in the library. Uses the cheap mmap-based
+    ## ELF scan when possible, otherwise falls back to loading the library
+    ## through ctypes and looking the symbols up directly.
+    found = _scan_elf_strtabs(os.path.join(pt, fname), symbol_names)
+    if found is not None:
+        return found
+    try:
+        import ctypes
+
+        lib = ctypes.CDLL(os.path.join(pt, fname))
+        found = set()
+        for nm in symbol_names:
+            try:
+                getattr(lib, nm)
+                found.add(nm)
+            except Exception:
+                pass
+        return found
+    except Exception:
+        return set()
+
+
+def _find_accelerate():
+    ## Detects Apple's Accelerate framework. Since Big Sur the framework binary
+    ## lives inside the dyld shared cache and might not exist as a file on
+    ## disk, so when the folder is absent, dlopen through ctypes is the
+    ## reliable check
+    fw_path = "/System/Library/Frameworks/Accelerate.framework"
+    if os.path.exists(fw_path):
+        return fw_path
+    try:
+        import ctypes
+
+        ctypes.CDLL(os.path.join(fw_path, "Accelerate"))
+        return fw_path
+    except Exception:
+        return None
+
+
+def _accelerate_newlapack_flags():
+    ## macOS >= 13.3 ships a second copy of the interface under '$NEWLAPACK'
+    ## symbol suffixes - LAPACK 3.9.1 instead of 3.2.1, with much faster BLAS
+    ## underneath plus proper ILP64 entry points ('$NEWLAPACK$ILP64'). The
+    ## classic symbols stay as slow as they were, so this has to be probed
+    ## through the dynamic loader rather than assumed from the OS version
+    try:
+        import ctypes
+
+        lib = ctypes.CDLL(
+            "/System/Library/Frameworks/Accelerate.framework/Accelerate"
+        )
+        flags = []
+        try:
+            getattr(lib, "cblas_ddot$NEWLAPACK")
+            flags.append("ACCELERATE_NEW_LAPACK")
+        except Exception:
+            return flags
+        try:
+            getattr(lib, "cblas_ddot$NEWLAPACK$ILP64")
+            flags.append("BLAS_ILP64")
+        except Exception:
+            pass
+        return flags
+    except Exception:
+        return []
+
+
+def _exists_parallel(paths):
+    ## Batched existence checks - on network filesystems (e.g. NFS-mounted conda
+    ## environments) each 'stat' call is a round-trip, so overlapping them bounds
+    ## the wall time by the slowest path instead of the sum of all of them
+    try:
+        from concurrent.futures import ThreadPoolExecutor
+
+        if len(paths) <= 8:
+            raise RuntimeError("too few paths to bother with threads")
+        with ThreadPoolExecutor(max_workers=min(32, len(paths))) as pool:
+            return set(
+                pt for pt, found in zip(paths, pool.map(os.path.exists, paths)) if found
+            )
+    except Exception:
+        return set(pt for pt in paths if os.path.exists(pt))
+
+
 def _deduplicate_paths(candidate_paths):
     ## Discards duplicated paths, but keep the order
     seen_paths = set()
@@ -1205,7 +2441,149 @@ def _try_add_from_command(str_expr, candidate_paths):
         pass
 
 
+def _scan_elf_strtabs(full_path, exact_names):
+    ## Minimal mmap-based ELF reader: seeks straight to the string tables
+    ## ('.dynstr'/'.strtab') through the section header table and searches only
+    ## for the names of interest, without copying the file into memory. For the
+    ## likes of a fat 'libopenblas.so' or 'libmkl_rt.so' this is orders of
+    ## magnitude cheaper than a full symbol-table parse.
+    ## Returns the subset of 'exact_names' that is present, or 'None' if the
+    ## file is not a parseable ELF object (e.g. a '.a' archive).
+    import mmap
+    import struct
+
+    try:
+        with open(full_path, "rb") as f:
+            mm = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+            try:
+                if mm[:4] != b"\x7fELF":
+                    return None
+                is_64bit = mm[4] == 2
+                endianness = "<" if (mm[5] == 1) else ">"
+                if is_64bit:
+                    (e_shoff,) = struct.unpack_from(endianness + "Q", mm, 0x28)
+                    e_shentsize, e_shnum, e_shstrndx = struct.unpack_from(
+                        endianness + "HHH", mm, 0x3A
+                    )
+                else:
+                    (e_shoff,) = struct.unpack_from(endianness + "I", mm, 0x20)
+                    e_shentsize, e_shnum, e_shstrndx = struct.unpack_from(
+                        endianness + "HHH", mm, 0x2E
+                    )
+                if (e_shoff == 0) or (e_shnum == 0):
+                    return None
+
+                def read_section_header(ix):
+                    offset = e_shoff + ix * e_shentsize
+                    (sh_name,) = struct.unpack_from(endianness + "I", mm, offset)
+                    if is_64bit:
+                        sh_offset, sh_size = struct.unpack_from(
+                            endianness + "QQ", mm, offset + 0x18
+                        )
+                    else:
+                        sh_offset, sh_size = struct.unpack_from(
+                            endianness + "II", mm, offset + 0x10
+                        )
+                    return sh_name, sh_offset, sh_size
+
+                shstrtab_offset = read_section_header(e_shstrndx)[1]
+                string_tables = []
+                for ix in range(e_shnum):
+                    sh_name, sh_offset, sh_size = read_section_header(ix)
+                    name_end = mm.find(b"\x00", shstrtab_offset + sh_name)
+                    section_name = mm[shstrtab_offset + sh_name : name_end]
+                    if section_name in (b".dynstr", b".strtab"):
+                        string_tables.append((sh_offset, sh_size))
+                if not len(string_tables):
+                    return None
+
+                found = set()
+                for sh_offset, sh_size in string_tables:
+                    for nm in exact_names:
+                        if nm in found:
+                            continue
+                        ## Names in the string tables are NUL-delimited, so this
+                        ## gives an exact match without decoding the whole table
+                        needle = b"\x00" + nm.encode() + b"\x00"
+                        if mm.find(needle, sh_offset, sh_offset + sh_size + 1) >= 0:
+                            found.add(nm)
+                return found
+            finally:
+                mm.close()
+    except Exception:
+        return None
+
+
+def _find_symbols_mmap(pt, fname):
+    found = _scan_elf_strtabs(
+        os.path.join(pt, fname),
+        [
+            "openblas_get_config",
+            "bli_axpyd",
+            "mkl_dcsrgemv",
+            "armplversion",
+            "nvpl_blas_get_version",
+            "ddot_",
+            "cblas_ddot",
+            "ddot",
+            "DDOT",
+            "ddot_64_",
+            "cblas_ddot64_",
+        ],
+    )
+    if found is None:
+        return None
+    ## ILP64 builds (e.g. 'libopenblas64_.so') export the 64-bit interface under
+    ## suffixed names; if only those are present, the library takes 64-bit indices
+    ilp64_flags = []
+    if (("ddot_64_" in found) or ("cblas_ddot64_" in found)) and (
+        ("ddot_" not in found) and ("cblas_ddot" not in found)
+    ):
+        ilp64_flags = ["BLAS_ILP64"]
+    if "openblas_get_config" in found:
+        return True, ["HAS_OPENBLAS", "HAS_UNDERSCORES"] + ilp64_flags
+    if "bli_axpyd" in found:
+        return True, ["HAS_BLIS", "HAS_UNDERSCORES"] + ilp64_flags
+    if "mkl_dcsrgemv" in found:
+        return True, ["HAS_MKL"] + ilp64_flags
+    if "armplversion" in found:
+        return True, ["HAS_ARMPL", "HAS_UNDERSCORES"] + ilp64_flags
+    if "nvpl_blas_get_version" in found:
+        return True, ["HAS_NVPL", "HAS_UNDERSCORES"] + ilp64_flags
+    if "ddot_" in found:
+        found_syms = ["HAS_UNDERSCORES"]
+        if "cblas_ddot" not in found:
+            found_syms += ["NO_CBLAS"]
+        return True, found_syms
+    if "cblas_ddot" in found:
+        return True, []
+    if ("ddot" in found) or ("DDOT" in found):
+        return True, ["NO_CBLAS"]
+    if len(ilp64_flags):
+        return True, ["HAS_UNDERSCORES"] + ilp64_flags
+    return True, None
+
+
 def _find_symbols(pt, fname):
+    ## Memoized by (st_dev, st_ino, st_mtime) so that each physical library is
+    ## only inspected once per run, no matter through how many symlinked paths
+    ## the search reaches it
+    ident = _file_identity(os.path.join(pt, fname))
+    if ident is None:
+        return _find_symbols_uncached(pt, fname)
+    key = "verdict|" + ident
+    cache = _load_inspection_cache()
+    if key not in cache:
+        cache[key] = list(_find_symbols_uncached(pt, fname))
+        _store_inspection_cache()
+    return tuple(cache[key])
+
+
+def _find_symbols_uncached(pt, fname):
+    res = _find_symbols_mmap(pt, fname)
+    if res is not None:
+        return res
+
     try:
         from elftools.elf.elffile import ELFFile
 
@@ -1218,6 +2596,10 @@ def _find_symbols(pt, fname):
                 return True, ["HAS_BLIS", "HAS_UNDERSCORES"]
             if symtab.get_symbol_by_name("mkl_dcsrgemv") is not None:
                 return True, ["HAS_MKL"]
+            if symtab.get_symbol_by_name("armplversion") is not None:
+                return True, ["HAS_ARMPL", "HAS_UNDERSCORES"]
+            if symtab.get_symbol_by_name("nvpl_blas_get_version") is not None:
+                return True, ["HAS_NVPL", "HAS_UNDERSCORES"]
             if symtab.get_symbol_by_name("ddot_") is not None:
                 found_syms = ["HAS_UNDERSCORES"]
                 if symtab.get_symbol_by_name("cblas_ddot") is None:
@@ -1249,6 +2631,10 @@ def _find_symbols(pt, fname):
                     return True, ["HAS_BLIS", "HAS_UNDERSCORES"]
                 if bool(re.search("mkl_dcsrgemv", s)):
                     return True, ["HAS_MKL"]
+                if bool(re.search("armplversion", s)):
+                    return True, ["HAS_ARMPL", "HAS_UNDERSCORES"]
+                if bool(re.search("nvpl_blas_get_version", s)):
+                    return True, ["HAS_NVPL", "HAS_UNDERSCORES"]
                 if bool(re.search(r"ddot_[^a-z]", s)):
                     has_underscores = True
                 if bool(re.search("cblas_ddot", s)):
@@ -0,0 +1,302 @@
+"""
+Benchmark the BLAS library that 'find_blas()' resolves in this environment.
+
+Times the key routines - 'ddot'/'daxpy' at a tiny size for call overhead,
+'dgemv' and 'dgemm' across a size sweep for throughput, plus the 'omatcopy'
+extension when the library provides it - through a 'ctypes' harness against
+the chosen library, and reports per-call latency and GFLOPS as
+machine-readable JSON. Two such reports can be diffed against each other,
+which allows gating environment upgrades on measured BLAS performance
+instead of vendor names:
+
+    python -m findblas.benchmark -o before.json
+    (upgrade the environment)
+    python -m findblas.benchmark -o after.json
+    python -m findblas.benchmark --diff before.json after.json
+
+The diff exits with a non-zero status when any routine regressed beyond the
+tolerance (10% by default), so it can terminate a deployment pipeline.
+"""
+import findblas, os, sys, json, time, warnings
+from sys import platform
+import platform as platform_module
+
+__all__ = ["run", "diff", "main"]
+
+## each measurement is repeated until it has accumulated at least this much
+## wall time, so tiny calls get averaged over many repetitions
+_min_secs_per_measurement = 0.15
+
+
+def _time_call(fn):
+    ## one warm-up call (page faults, lazy symbol binding, thread-pool spin-up),
+    ## then a calibration pass to decide the repetition count
+    fn()
+    t0 = time.perf_counter()
+    fn()
+    est = time.perf_counter() - t0
+    reps = max(3, int(_min_secs_per_measurement / max(est, 1e-9)))
+    t0 = time.perf_counter()
+    for _ in range(reps):
+        fn()
+    return reps, time.perf_counter() - t0
+
+
+def _load_routines(blas_path, blas_file, flags):
+    ## Resolves the routines to benchmark from the library. Prefers the CBLAS
+    ## entry points; when the library only has the underscored Fortran symbols
+    ## ('NO_CBLAS' + 'HAS_UNDERSCORES'), wraps those instead - same calls the
+    ## shims in "findblas_fortran.h" would end up making
+    import ctypes
+
+    lib = ctypes.CDLL(os.path.join(blas_path, blas_file))
+    c_int = ctypes.c_longlong if ("BLAS_ILP64" in flags) else ctypes.c_int
+    c_dbl = ctypes.c_double
+
+    use_fortran = ("NO_CBLAS" in flags) and ("HAS_UNDERSCORES" in flags)
+    if not use_fortran:
+        cblas_ddot = lib.cblas_ddot
+        cblas_ddot.restype = c_dbl
+        cblas_daxpy = lib.cblas_daxpy
+        cblas_dgemv = lib.cblas_dgemv
+        cblas_dgemm = lib.cblas_dgemm
+        ddot = lambda n, x, y: cblas_ddot(c_int(n), x, c_int(1), y, c_int(1))
+        daxpy = lambda n, x, y: cblas_daxpy(
+            c_int(n), c_dbl(1.001), x, c_int(1), y, c_int(1)
+        )
+        ## column-major with no transposition, same layout the Fortran path uses
+        dgemv = lambda m, n, A, x, y: cblas_dgemv(
+            102, 111, c_int(m), c_int(n), c_dbl(1.0),
+            A, c_int(m), x, c_int(1), c_dbl(0.0), y, c_int(1)
+        )
+        dgemm = lambda n, A, B, C: cblas_dgemm(
+            102, 111, 111, c_int(n), c_int(n), c_int(n), c_dbl(1.0),
+            A, c_int(n), B, c_int(n), c_dbl(0.0), C, c_int(n)
+        )
+    else:
+        byref = ctypes.byref
+        f_ddot = lib.ddot_
+        f_ddot.restype = c_dbl
+        f_daxpy = lib.daxpy_
+        f_dgemv = lib.dgemv_
+        f_dgemm = lib.dgemm_
+        one_i = c_int(1)
+        one_d = c_dbl(1.0)
+        zero_d = c_dbl(0.0)
+        alpha_d = c_dbl(1.001)
+        no_trans = ctypes.c_char_p(b"N")
+        ddot = lambda n, x, y: f_ddot(byref(c_int(n)), x, byref(one_i), y, byref(one_i))
+        daxpy = lambda n, x, y: f_daxpy(
+            byref(c_int(n)), byref(alpha_d), x, byref(one_i), y, byref(one_i)
+        )
+        dgemv = lambda m, n, A, x, y: f_dgemv(
+            no_trans, byref(c_int(m)), byref(c_int(n)), byref(one_d),
+            A, byref(c_int(m)), x, byref(one_i), byref(zero_d), y, byref(one_i)
+        )
+        dgemm = lambda n, A, B, C: f_dgemm(
+            no_trans, no_trans, byref(c_int(n)), byref(c_int(n)), byref(c_int(n)),
+            byref(one_d), A, byref(c_int(n)), B, byref(c_int(n)),
+            byref(zero_d), C, byref(c_int(n))
+        )
+
+    ## 'omatcopy' is a vendor extension with no Fortran-level equivalent worth
+    ## wrapping - only measured when the CBLAS entry point is there
+    domatcopy = None
+    if (not use_fortran) and ("HAS_CBLAS_OMATCOPY" in flags):
+        try:
+            cblas_domatcopy = lib.cblas_domatcopy
+            domatcopy = lambda n, A, B: cblas_domatcopy(
+                102, 112, c_int(n), c_int(n), c_dbl(1.0),
+                A, c_int(n), B, c_int(n)
+            )
+        except Exception:
+            pass
+
+    return ddot, daxpy, dgemv, dgemm, domatcopy
+
+
+def run(sizes=(64, 256, 1024), use_cache=True):
+    """
+    Benchmark the BLAS library resolved by 'find_blas()'
+
+    Parameters
+    ----------
+    sizes : tuple of int
+        Dimensions for the throughput sweep - 'dgemv' runs at each size as a
+        square matrix-vector product, 'dgemm' (and 'omatcopy' when available)
+        as a square matrix product. The call-overhead measurements ('ddot' and
+        'daxpy' at n=8) always run regardless.
+    use_cache : bool
+        Whether to let the underlying 'find_blas()' call use its discovery cache.
+
+    Returns
+    -------
+    report : dict
+        Machine-readable report with the resolved library, host information,
+        and one entry per (routine, size) containing the repetition count,
+        per-call latency in microseconds, and GFLOPS where meaningful
+        ('omatcopy' reports GB/s of data moved instead).
+    """
+    import ctypes
+
+    blas_path, blas_file, incl_path, incl_file, flags = findblas.find_blas(
+        use_cache=use_cache
+    )
+    if (blas_path is None) or (blas_file is None):
+        raise ValueError("No BLAS library to benchmark in this environment.")
+    ddot, daxpy, dgemv, dgemm, domatcopy = _load_routines(blas_path, blas_file, flags)
+
+    results = []
+
+    def add_result(routine, size, reps, elapsed, flop=None, moved_bytes=None):
+        entry = {
+            "routine": routine,
+            "size": size,
+            "calls": reps,
+            "total_secs": elapsed,
+            "per_call_us": 1e6 * elapsed / reps,
+        }
+        if flop is not None:
+            entry["gflops"] = 1e-9 * flop * reps / elapsed
+        if moved_bytes is not None:
+            entry["gb_per_sec"] = 1e-9 * moved_bytes * reps / elapsed
+        results.append(entry)
+
+    ## call overhead: tiny vectors, dominated by dispatch cost rather than math
+    n_small = 8
+    x = (ctypes.c_double * n_small)(*([1.001] * n_small))
+    y = (ctypes.c_double * n_small)(*([0.999] * n_small))
+    reps, elapsed = _time_call(lambda: ddot(n_small, x, y))
+    add_result("ddot", n_small, reps, elapsed, flop=2 * n_small)
+    reps, elapsed = _time_call(lambda: daxpy(n_small, x, y))
+    add_result("daxpy", n_small, reps, elapsed, flop=2 * n_small)
+
+    ## throughput sweep
+    for sz in sizes:
+        A = (ctypes.c_double * (sz * sz))(*([1.0 / sz] * (sz * sz)))
+        xv = (ctypes.c_double * sz)(*([1.0] * sz))
+        yv = (ctypes.c_double * sz)()
+        reps, elapsed = _time_call(lambda: dgemv(sz, sz, A, xv, yv))
+        add_result("dgemv", sz, reps, elapsed, flop=2 * sz * sz)
+
+        B = (ctypes.c_double * (sz * sz))(*([1.0 / sz] * (sz * sz)))
+        C = (ctypes.c_double * (sz * sz))()
+        reps, elapsed = _time_call(lambda: dgemm(sz, A, B, C))
+        add_result("dgemm", sz, reps, elapsed, flop=2 * sz * sz * sz)
+
+        if domatcopy is not None:
+            reps, elapsed = _time_call(lambda: domatcopy(sz, A, C))
+            add_result("domatcopy", sz, reps, elapsed, moved_bytes=2 * 8 * sz * sz)
+
+    return {
+        "library": {"path": blas_path, "file": blas_file, "flags": flags},
+        "machine": platform_module.machine(),
+        "platform": platform,
+        "python": sys.version.split()[0],
+        "timestamp": time.strftime("%Y-%m-%dT%H:%M:%S"),
+        "results": results,
+    }
+
+
+def diff(before, after, tolerance=0.1):
+    """
+    Compare two benchmark reports
+
+    Parameters
+    ----------
+    before : dict
+        Baseline report, as returned by 'run' (or loaded from its JSON output).
+    after : dict
+        Report to compare against the baseline.
+    tolerance : float
+        Relative slowdown beyond which an entry is marked as a regression
+        (0.1 = a routine may get up to 10% slower before it counts).
+
+    Returns
+    -------
+    entries : list of dict
+        One entry per (routine, size) present in both reports, with the
+        per-call latencies, the speedup of 'after' over 'before' (> 1 means
+        faster), and a 'regression' marker.
+    """
+    before_by_key = {(r["routine"], r["size"]): r for r in before["results"]}
+    entries = []
+    for r in after["results"]:
+        key = (r["routine"], r["size"])
+        if key not in before_by_key:
+            continue
+        speedup = before_by_key[key]["per_call_us"] / r["per_call_us"]
+        entries.append(
+            {
+                "routine": r["routine"],
+                "size": r["size"],
+                "before_us": before_by_key[key]["per_call_us"],
+                "after_us": r["per_call_us"],
+                "speedup": speedup,
+                "regression": speedup < (1.0 - tolerance),
+            }
+        )
+    return entries
+
+
+def main(argv=None):
+    import argparse
+
+    parser = argparse.ArgumentParser(
+        prog="python -m findblas.benchmark",
+        description="Benchmark the BLAS library that 'find_blas()' resolves, "
+        "or diff two saved benchmark reports.",
+    )
+    parser.add_argument(
+        "-o", "--output", metavar="FILE",
+        help="write the JSON report to this file instead of stdout",
+    )
+    parser.add_argument(
+        "--sizes", default="64,256,1024",
+        help="comma-separated dimensions for the dgemv/dgemm sweep (default: %(default)s)",
+    )
+    parser.add_argument(
+        "--diff", nargs=2, metavar=("BEFORE", "AFTER"),
+        help="instead of benchmarking, compare two saved reports; "
+        "exits with status 1 when something regressed beyond the tolerance",
+    )
+    parser.add_argument(
+        "--tolerance", type=float, default=0.1,
+        help="relative slowdown tolerated before --diff flags a regression (default: %(default)s)",
+    )
+    args = parser.parse_args(argv)
+
+    if args.diff is not None:
+        with open(args.diff[0]) as f:
+            before = json.load(f)
+        with open(args.diff[1]) as f:
+            after = json.load(f)
+        entries = diff(before, after, args.tolerance)
+        print(json.dumps(entries, indent=2))
+        for e in entries:
+            if e["regression"]:
+                print(
+                    "Regression: %s at size %s got %.1f%% slower (%.2fus -> %.2fus)"
+                    % (
+                        e["routine"],
+                        e["size"],
+                        100 * (1 - e["speedup"]),
+                        e["before_us"],
+                        e["after_us"],
+                    ),
+                    file=sys.stderr,
+                )
+        return 1 if any(e["regression"] for e in entries) else 0
+
+    sizes = tuple(int(s) for s in args.sizes.split(",") if s.strip() != "")
+    report = run(sizes=sizes)
+    if args.output is not None:
+        with open(args.output, "w") as f:
+            json.dump(report, f, indent=2)
+    else:
+        print(json.dumps(report, indent=2))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -4,6 +4,267 @@ from sys import platform
 import platform as platform_module
 
 
+def _cpu_feature_flags():
+    """
+    Probe the build host's CPU capabilities, returning flags such as
+    'FINDBLAS_HAS_AVX2' / 'FINDBLAS_HAS_AVX512F' / 'FINDBLAS_HAS_NEON' to be
+    passed to the compiled extensions alongside the BLAS flags.
+
+    Can be overriden through environment variable 'FINDBLAS_CPU_FLAGS' (e.g.
+    'FINDBLAS_CPU_FLAGS="avx2,fma"'), which takes precedence over the probe -
+    intended for cross-compiling and for building portable wheels, where
+    baking in the build host's features would be wrong. Setting it to an
+    empty string or to 'none' disables the flags altogether.
+    """
+    ## explicit override takes precedence
+    if "FINDBLAS_CPU_FLAGS" in os.environ:
+        requested = os.environ["FINDBLAS_CPU_FLAGS"].strip()
+        if (requested == "") or (requested.lower() == "none"):
+            return []
+        return [
+            "FINDBLAS_HAS_" + f.strip().upper().replace(".", "")
+            for f in requested.split(",")
+            if f.strip() != ""
+        ]
+
+    ## ARMv8 and later always carry NEON
+    machine = platform_module.machine().lower()
+    if bool(re.search(r"^(aarch64|arm64)", machine)):
+        return ["FINDBLAS_HAS_NEON"]
+
+    ## the names under which each feature of interest might be reported
+    ## ('/proc/cpuinfo' on linux, 'sysctl' on mac)
+    known = [
+        ("AVX", {"avx", "avx1.0"}),
+        ("AVX2", {"avx2", "avx2.0"}),
+        ("FMA", {"fma"}),
+        ("AVX512F", {"avx512f"}),
+    ]
+    feats = set()
+    if platform[:3] == "lin":
+        try:
+            with open("/proc/cpuinfo") as f:
+                for ln in f:
+                    if bool(re.search(r"^(flags|Features)", ln)):
+                        feats = set(ln.split(":")[1].lower().split())
+                        break
+        except Exception:
+            pass
+    elif platform[:3] == "dar":
+        try:
+            import subprocess
+
+            outp = subprocess.check_output(
+                [
+                    "sysctl",
+                    "-n",
+                    "machdep.cpu.features",
+                    "machdep.cpu.leaf7_features",
+                ]
+            )
+            feats = set(outp.decode().lower().split())
+        except Exception:
+            pass
+    else:
+        ## no reliable probe on windows without extra modules - rely on the
+        ## 'FINDBLAS_CPU_FLAGS' override there
+        pass
+    return ["FINDBLAS_HAS_" + name for name, aliases in known if len(feats & aliases)]
+
+
+def _decide_build_jobs(parallel_option):
+    ## Number of concurrent compile jobs: the '--parallel'/'-j' build_ext
+    ## option wins, then environment variable 'CPU_COUNT' (as set by e.g.
+    ## conda-build), and otherwise all the cores this process may run on.
+    ## Set either to 1 to force a serial build.
+    n_jobs = parallel_option
+    if n_jobs in (None, 0, ""):
+        n_jobs = os.environ.get("CPU_COUNT", "")
+    if n_jobs is True:
+        n_jobs = ""
+    try:
+        n_jobs = int(n_jobs)
+    except Exception:
+        n_jobs = 0
+    if n_jobs <= 0:
+        try:
+            n_jobs = len(os.sched_getaffinity(0))
+        except Exception:
+            n_jobs = os.cpu_count()
+        if n_jobs is None:
+            n_jobs = 1
+    return n_jobs
+
+
+def _make_parallel_compile(compiler, n_jobs):
+    ## Replacement for 'compiler.compile' that fans the translation units out
+    ## over a thread pool - each job spends its time inside a compiler
+    ## subprocess, so the GIL is idle and threads scale about linearly, while
+    ## (unlike 'multiprocessing') still sharing the already-configured
+    ## compiler object. Same approach numpy.distutils used. Only works with
+    ## compiler classes that implement the '_compile' single-file hook, which
+    ## excludes MSVC - that one batches all sources into one 'cl.exe' call.
+    def compile_parallel(
+        sources,
+        output_dir=None,
+        macros=None,
+        include_dirs=None,
+        debug=0,
+        extra_preargs=None,
+        extra_postargs=None,
+        depends=None,
+    ):
+        macros, objects, extra_postargs, pp_opts, build = compiler._setup_compile(
+            output_dir, macros, include_dirs, sources, depends, extra_postargs
+        )
+        cc_args = compiler._get_cc_args(pp_opts, debug, extra_preargs)
+
+        def compile_single(obj):
+            try:
+                src, ext = build[obj]
+            except KeyError:
+                return
+            compiler._compile(obj, src, ext, cc_args, extra_postargs, pp_opts)
+
+        from multiprocessing.pool import ThreadPool
+
+        ## errors in the workers propagate out of 'map' as they would serially
+        with ThreadPool(min(n_jobs, max(len(build), 1))) as pool:
+            pool.map(compile_single, objects)
+        return objects
+
+    return compile_parallel
+
+
+def _write_runtime_pin_stub(build_temp, blas_path, blas_file):
+    ## Generates the loader stub for the deployment-resolution mode (see the
+    ## 'FINDBLAS_RUNTIME_PIN' handling in 'build_ext_with_blas'): a constructor
+    ## that runs when the extension is loaded, resolves the best available BLAS
+    ## by vendor priority - identifying each candidate through the same marker
+    ## symbols the build-time inspection goes by - and 'dlopen's it with
+    ## 'RTLD_GLOBAL', warning loudly when only reference (netlib) BLAS is
+    ## around. Returns the path of the written file.
+    if platform[:3] == "dar":
+        generic_names = [
+            "libmkl_rt.dylib",
+            "libarmpl.dylib",
+            "libopenblas.dylib",
+            "libblis.dylib",
+            "libtatlas.dylib", "libsatlas.dylib", "libatlas.dylib",
+            "libgslcblas.dylib",
+            "libcblas.dylib", "libblas.dylib",
+        ]
+    else:
+        generic_names = [
+            "libmkl_rt.so", "libmkl_rt.so.2", "libmkl_rt.so.1",
+            "libarmpl.so", "libarmpl_lp64_mp.so",
+            "libnvpl_blas_lp64_gomp.so.0", "libnvpl_blas_lp64_seq.so.0",
+            "libopenblas.so", "libopenblas.so.0",
+            "libblis.so", "libblis-mt.so",
+            "libtatlas.so", "libsatlas.so", "libatlas.so",
+            "libgslcblas.so",
+            "libcblas.so", "libblas.so", "libblas.so.3",
+        ]
+
+    ## the library that was linked at build time goes first - by its absolute
+    ## path, then by its bare file name so the loader can still find it when
+    ## the deployment host keeps it under a different prefix
+    candidates = [os.path.join(blas_path, blas_file), blas_file]
+    candidates += [f for f in generic_names if f != blas_file]
+
+    lines = [
+        "/* Generated by findblas' 'build_ext_with_blas' - do not edit.",
+        "   Deployment-resolution stub: resolves the best available BLAS library",
+        "   when the extension is loaded, instead of trusting the build-host",
+        "   rpath to stay valid on the machine the wheel lands on. */",
+        "#include <stdio.h>",
+        "#include <stdlib.h>",
+        "#include <dlfcn.h>",
+        "",
+        "static const char *findblas__pin_candidates[] = {",
+    ]
+    lines += ['    "%s",' % c for c in candidates]
+    lines += [
+        "    NULL",
+        "};",
+        "",
+        "/* same identification logic as the symbol inspection on the python side:",
+        "   a vendor marker symbol wins, a plain 'ddot' means reference BLAS */",
+        "static int findblas__pin_identify(void *handle)",
+        "{",
+        '    if (dlsym(handle, "mkl_dcsrgemv") != NULL) return 2;',
+        '    if (dlsym(handle, "openblas_get_config") != NULL) return 2;',
+        '    if (dlsym(handle, "bli_axpyd") != NULL) return 2;',
+        '    if (dlsym(handle, "armplversion") != NULL) return 2;',
+        '    if (dlsym(handle, "nvpl_blas_get_version") != NULL) return 2;',
+        '    if ((dlsym(handle, "cblas_ddot") != NULL) || (dlsym(handle, "ddot_") != NULL)) return 1;',
+        "    return 0;",
+        "}",
+        "",
+        "__attribute__((constructor))",
+        "static void findblas__pin_blas(void)",
+        "{",
+        "    void *handle;",
+        "    const char *reference_name = NULL;",
+        "    const char *override_lib;",
+        "    int ix;",
+        "",
+        '    override_lib = getenv("FINDBLAS_PIN_LIBRARY");',
+        "    if (override_lib != NULL && override_lib[0] != '\\0') {",
+        "        if (dlopen(override_lib, RTLD_NOW | RTLD_GLOBAL) != NULL)",
+        "            return;",
+        "        fprintf(stderr, \"findblas: could not load pinned BLAS library '%s': %s\\n\",",
+        "                override_lib, dlerror());",
+        "    }",
+        "",
+        "    /* probe with RTLD_LOCAL first - only the library that gets kept may",
+        "       enter the global scope, and in priority order */",
+        "    for (ix = 0; findblas__pin_candidates[ix] != NULL; ix++) {",
+        "        handle = dlopen(findblas__pin_candidates[ix], RTLD_NOW | RTLD_LOCAL);",
+        "        if (handle == NULL)",
+        "            continue;",
+        "        switch (findblas__pin_identify(handle)) {",
+        "            case 2:",
+        "                dlopen(findblas__pin_candidates[ix], RTLD_NOW | RTLD_GLOBAL);",
+        "                dlclose(handle);",
+        "                return;",
+        "            case 1:",
+        "                if (reference_name == NULL)",
+        "                    reference_name = findblas__pin_candidates[ix];",
+        "                dlclose(handle);",
+        "                break;",
+        "            default:",
+        "                dlclose(handle);",
+        "        }",
+        "    }",
+        "",
+        "    if (reference_name != NULL) {",
+        "        dlopen(reference_name, RTLD_NOW | RTLD_GLOBAL);",
+        "        fprintf(stderr,",
+        '                "findblas: WARNING: only reference (netlib) BLAS was found at load time'
+        " ('%s') - "
+        'BLAS calls will run far slower than on the build host. '
+        "Install MKL/OpenBLAS/BLIS on this machine, or point environment variable "
+        "'FINDBLAS_PIN_LIBRARY' at a faster library.\\n\",",
+        "                reference_name);",
+        "    }",
+        "    else {",
+        "        fprintf(stderr,",
+        '                "findblas: WARNING: could not resolve any BLAS library at load time - '
+        'falling back to whatever the dynamic loader linked.\\n");',
+        "    }",
+        "}",
+        "",
+    ]
+
+    if not os.path.exists(build_temp):
+        os.makedirs(build_temp)
+    out_path = os.path.join(build_temp, "findblas_runtime_pin.c")
+    with open(out_path, "w") as f:
+        f.write("\n".join(lines))
+    return out_path
+
+
 ## https://stackoverflow.com/questions/52905458/link-cython-wrapped-c-functions-against-blas-from-numpy
 class build_ext_with_blas(build_ext):
     """
@@ -19,12 +280,24 @@ class build_ext_with_blas(build_ext):
         nocblas_err_msg += ", 'conda install mkl-devel' (Linux / Mac)"
         nocblas_err_msg += ", or 'pip install mkl-devel' (Windows / Linux / Mac)."
         from_rtd = os.environ.get("READTHEDOCS") == "True"
+        ## deliberate static linking (see 'prefer_static' in 'find_blas') - lets
+        ## extensions use '-flto' across the BLAS boundary and skip the PLT
+        ## indirection on every small call
+        static_blas = os.environ.get("FINDBLAS_STATIC_BLAS", "") != ""
         if not from_rtd:
             blas_path, blas_file, incl_path, incl_file, flags = findblas.find_blas(
                 allow_unidentified_blas=False,
                 allow_pep518_paths=False,
+                prefer_static=static_blas,
             )
-            if (blas_file is None) or (blas_path is None):
+            ## 'find_blas' comes back with this flag (and no library) when nothing
+            ## was found but environment variable 'FINDBLAS_FALLBACK' is set - in
+            ## that case the bundled reference kernels get compiled in, through
+            ## the same route as the ReadTheDocs mock
+            use_fallback = "FINDBLAS_FALLBACK" in flags
+            if use_fallback:
+                pass
+            elif (blas_file is None) or (blas_path is None):
                 raise ValueError(nocblas_err_msg)
             elif blas_file == "mkl_rt.dll":
                 txt = "Found MKL library at:\n" + os.path.join(blas_path, blas_file)
@@ -44,10 +317,18 @@ class build_ext_with_blas(build_ext):
         else:
             flags = ["_FOR_RTD"]
             blas_path, blas_file, incl_path, incl_file = [None] * 4
+            use_fallback = False
 
         ## if no CBLAS and no functions are present, there will be no prototypes for the cblas API
         if "NO_CBLAS" in flags:
-            raise ValueError(nocblas_err_msg)
+            ## when the library still has the underscored Fortran symbols, 'findblas.h'
+            ## provides inline 'cblas_*' wrappers over them (see 'findblas_fortran.h')
+            if "HAS_UNDERSCORES" in flags:
+                warnings.warn(
+                    "Found BLAS library has no CBLAS interface - will use inline wrappers over its Fortran symbols."
+                )
+            else:
+                raise ValueError(nocblas_err_msg)
 
         ## Add findblas' header
         ## if installing with pip or setuptools, will be here (this is the ideal case)
@@ -148,7 +429,11 @@ class build_ext_with_blas(build_ext):
         gsl_err_msg = (
             "Missing GSL CBLAS headers, please reinstall with e.g. 'conda install gsl'."
         )
-        if incl_file == "mkl_cblas.h":
+        if "HAS_ACCELERATE" in flags:
+            ## the framework brings its own headers through '-framework Accelerate',
+            ## there is nothing separate to include
+            pass
+        elif incl_file == "mkl_cblas.h":
             flags.append("MKL_OWN_INCL_CBLAS")
         elif incl_file == "mkl_blas.h":
             raise ValueError(mkl_err_msg)
@@ -158,6 +443,10 @@ class build_ext_with_blas(build_ext):
             flags.append("GSL_OWN_INCL_CBLAS")
         elif incl_file == "gsl_blas.h":
             raise ValueError(gsl_err_msg)
+        elif incl_file == "armpl.h":
+            flags.append("ARMPL_OWN_INCL")
+        elif incl_file in ("nvpl_blas.h", "nvpl_blas_cblas.h"):
+            flags.append("NVPL_OWN_INCL")
         elif incl_file == "INCL_CBLAS":
             flags.append("INCL_CBLAS")
         elif incl_file == "blas.h":
@@ -169,11 +458,130 @@ class build_ext_with_blas(build_ext):
         else:
             pass
 
+        ## Optionally also locate and link LAPACK (opt-in, for extensions that
+        ## include "findlapack.h")
+        lapack_link_args = []
+        lapack_incl_path = None
+        if (
+            (not from_rtd)
+            and (not use_fallback)
+            and (os.environ.get("FINDBLAS_LINK_LAPACK", "") != "")
+        ):
+            try:
+                (
+                    lapack_path,
+                    lapack_file,
+                    lapack_incl_path,
+                    lapack_incl_file,
+                    lapack_flags,
+                ) = findblas.find_lapack()
+            except Exception:
+                lapack_path = None
+                warnings.warn(
+                    "Could not locate a LAPACK library - extensions will link against BLAS only."
+                )
+            if lapack_path is not None:
+                for f in lapack_flags:
+                    if f not in flags:
+                        flags.append(f)
+                if lapack_incl_file == "mkl_lapacke.h":
+                    flags.append("MKL_OWN_INCL_LAPACKE")
+                elif lapack_incl_file == "lapacke.h":
+                    flags.append("INCL_LAPACKE")
+                elif (lapack_incl_file is None) and ("HAS_MKL" not in lapack_flags):
+                    flags.append("NO_LAPACKE_HEADER")
+                ## when LAPACK comes bundled in the BLAS library, no extra link is needed
+                if (lapack_path != blas_path) or (lapack_file != blas_file):
+                    if self.compiler.compiler_type == "msvc":
+                        lapack_link_args += [os.path.join(lapack_path, lapack_file)]
+                    elif platform[:3] != "dar":
+                        lapack_link_args += ["-L" + lapack_path, "-l:" + lapack_file]
+                        if not bool(re.search(r"\.a$", lapack_file)):
+                            lapack_link_args += ["-Wl,-rpath=" + lapack_path]
+                    else:
+                        lapack_shortened = re.sub(r"^lib", "", lapack_file)
+                        lapack_shortened = re.sub(r"\.[A-Za-z]+$", "", lapack_shortened)
+                        lapack_link_args += [
+                            "-L" + lapack_path,
+                            "-l" + lapack_shortened,
+                            "-Wl,-rpath," + lapack_path,
+                        ]
+
+        ## CPU-capability flags, for extensions that compile their own SIMD
+        ## kernels alongside the BLAS calls (see also 'findblas_cpu_supports()'
+        ## in "findblas.h" for runtime checks)
+        if not from_rtd:
+            flags += _cpu_feature_flags()
+
+        ## Optionally write the flags into a generated header instead of passing
+        ## them as -D macros - this keeps the compiler command line identical
+        ## across machines, so ccache/sccache-style shared compile caches can
+        ## reuse the object files
+        config_header_fold = None
+        if os.environ.get("FINDBLAS_CONFIG_HEADER", "") != "":
+            config_header_fold = self.build_temp
+            if not os.path.exists(config_header_fold):
+                os.makedirs(config_header_fold)
+            with open(
+                os.path.join(config_header_fold, "findblas_config.h"), "w"
+            ) as h:
+                h.write("/* Generated by findblas' 'build_ext_with_blas' - do not edit */\n")
+                h.write("#ifndef FINDBLAS_CONFIG_INCLUDED\n")
+                h.write("#define FINDBLAS_CONFIG_INCLUDED\n")
+                for f in flags:
+                    h.write("#define %s\n" % f)
+                if incl_path is not None:
+                    h.write('/* resolved BLAS include: %s */\n' % incl_path)
+                h.write("#endif\n")
+
+        ## Deployment-resolution mode (opt-in through environment variable
+        ## 'FINDBLAS_RUNTIME_PIN'): the rpath emitted below pins extensions to
+        ## the build host's library path, and when that path does not exist on
+        ## the machine the wheel lands on, the loader falls back to whatever
+        ## 'libblas.so' the distro symlinks - often reference netlib BLAS,
+        ## silently much slower. This mode compiles a small generated stub into
+        ## each extension that re-resolves the best available library by vendor
+        ## priority at load time, 'dlopen'ing it with 'RTLD_GLOBAL' and warning
+        ## loudly when only reference BLAS is around. Calls that are still
+        ## unbound when the stub runs (lazy PLT binding, and everything under
+        ## 'FINDBLAS_RUNTIME_DISPATCH') then resolve against the pinned
+        ## library; eagerly-bound calls at least get the loud diagnosis.
+        runtime_pin_src = None
+        if (
+            (os.environ.get("FINDBLAS_RUNTIME_PIN", "") != "")
+            and (platform[:3] != "win")
+            and not (from_rtd or use_fallback)
+            and ("HAS_ACCELERATE" not in flags)
+            and not bool(re.search(r"\.a$", blas_file))
+        ):
+            runtime_pin_src = _write_runtime_pin_stub(
+                self.build_temp, blas_path, blas_file
+            )
+
         ## Now add them to the extension
         for e in self.extensions:
-            if not from_rtd:
+            if not (from_rtd or use_fallback):
                 if self.compiler.compiler_type == "msvc":  # visual studio
                     e.extra_link_args += [os.path.join(blas_path, blas_file)]
+                elif "HAS_ACCELERATE" in flags:
+                    ## not a plain dylib - let the linker resolve the framework
+                    e.extra_link_args += ["-framework", "Accelerate"]
+                elif static_blas and bool(re.search(r"\.a$", blas_file)):
+                    ## deliberate static link - pass the archive directly (plays
+                    ## better with '-flto' than '-l:'), then the library's own
+                    ## dependency closure, which the shared objects would have
+                    ## carried as DT_NEEDED entries
+                    e.extra_link_args += [os.path.join(blas_path, blas_file)]
+                    if "HAS_OPENBLAS" in flags:
+                        e.extra_link_args += ["-lgfortran", "-lpthread", "-lm"]
+                    elif "HAS_BLIS" in flags:
+                        e.extra_link_args += ["-lpthread", "-lm"]
+                    elif "HAS_MKL" in flags:
+                        e.extra_link_args += ["-lpthread", "-lm", "-ldl"]
+                    elif "HAS_GSL" in flags:
+                        e.extra_link_args += ["-lgslcblas", "-lm"]
+                    else:
+                        e.extra_link_args += ["-lm"]
                 else:  # everything else which cares about following standards
                     if platform[:3] != "dar":
                         e.extra_link_args += ["-L" + blas_path, "-l:" + blas_file]
@@ -194,9 +602,29 @@ class build_ext_with_blas(build_ext):
 
             else:
                 e.sources.append(os.path.join(finblas_head_fold, "rtd_mock.c"))
-            e.define_macros += [(f, None) for f in flags]
+            if runtime_pin_src is not None:
+                e.sources.append(runtime_pin_src)
+                if platform[:3] == "lin":
+                    ## the stub can only preempt calls that are still unbound
+                    ## when it runs - keep PLT binding lazy even on distros
+                    ## that default the linker to '-Wl,-z,now'
+                    e.extra_link_args += ["-Wl,-z,lazy", "-ldl"]
+            if config_header_fold is not None:
+                e.include_dirs.insert(0, config_header_fold)
+            else:
+                e.define_macros += [(f, None) for f in flags]
             if incl_path is not None:
                 e.include_dirs.append(incl_path)
+            e.extra_link_args += lapack_link_args
+            if lapack_incl_path is not None:
+                e.include_dirs.append(lapack_incl_path)
             e.include_dirs.append(finblas_head_fold)
 
+        ## Compile independent translation units concurrently - the BLAS lookup
+        ## above already happened once for the whole build, so the workers only
+        ## run the compiler itself
+        n_jobs = _decide_build_jobs(getattr(self, "parallel", None))
+        if (n_jobs > 1) and hasattr(self.compiler, "_compile"):
+            self.compiler.compile = _make_parallel_compile(self.compiler, n_jobs)
+
         build_ext.build_extensions(self)
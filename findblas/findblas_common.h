@@ -0,0 +1,164 @@
+/*	https://www.github.com/david-cortes/findblas
+	Shared vendor-dispatch logic for the findblas headers - this is what picks
+	the correct BLAS header for the vendor that 'find_blas()' identified (or
+	the runtime-dispatch / Fortran-shim modes), and defines the common types
+	when no vendor header is present. The level-scoped modules
+	("findblas_level1.h" / "findblas_level2.h" / "findblas_level3.h" /
+	"findblas_ext.h") each include this file so they stay standalone; include
+	"findblas.h" to get the whole catalog plus the optional shims.
+	*/
+#ifndef FINDBLAS_COMMON_H
+#define FINDBLAS_COMMON_H
+
+/*	If 'build_ext_with_blas' was told to write its flags into a generated
+	"findblas_config.h" (environment variable 'FINDBLAS_CONFIG_HEADER') instead
+	of passing them as -D command-line macros, pick that file up here - keeping
+	the compiler command line identical across machines makes the object files
+	reusable by ccache/sccache-style compile caches. */
+#if defined(__has_include) && !defined(FINDBLAS_NO_CONFIG_HEADER)
+#  if __has_include("findblas_config.h")
+#    include "findblas_config.h"
+#  endif
+#endif
+
+/*	Integer type for indices and dimensions: 32-bit by default (LP64 interface),
+	64-bit when linking an ILP64 build (e.g. 'libopenblas64_.so', MKL's ILP64
+	interface) - 'find_blas()' emits the 'BLAS_ILP64' flag in that case.
+	Can also be forced manually by defining 'FINDBLAS_ILP64'. */
+#ifndef FINDBLAS_INT_DEFINED
+#define FINDBLAS_INT_DEFINED
+#if defined(BLAS_ILP64) || defined(FINDBLAS_ILP64)
+typedef long long findblas_int;
+#else
+typedef int findblas_int;
+#endif
+#endif
+
+#if defined FINDBLAS_RUNTIME_DISPATCH
+  #include "findblas_dispatch.h"
+#elif defined(NO_CBLAS) && defined(HAS_UNDERSCORES) && !defined(FINDBLAS_NO_FORTRAN_SHIM)
+  /* library has the fast Fortran symbols but no CBLAS layer - wrap them */
+  #include "findblas_fortran.h"
+#elif defined MKL_OWN_INCL_CBLAS
+  #include "mkl_cblas.h"
+#elif defined(USE_MKL) && !defined(NO_CBLAS_HEADER)
+  #include "mkl.h"
+#elif defined OPENBLAS_OWN_INCL
+  #include "cblas-openblas.h"
+#elif defined GSL_OWN_INCL_CBLAS
+  #include "gsl_cblas.h"
+#elif defined ARMPL_OWN_INCL
+  /* ARM Performance Libraries - "armpl.h" covers the full CBLAS catalog;
+     ILP64 builds ('libarmpl_ilp64*') want INTEGER64 defined before it */
+  #if defined(BLAS_ILP64) && !defined(INTEGER64)
+    #define INTEGER64
+  #endif
+  #include "armpl.h"
+#elif defined NVPL_OWN_INCL
+  #if defined(BLAS_ILP64) && !defined(NVPL_ILP64)
+    #define NVPL_ILP64
+  #endif
+  #include "nvpl_blas_cblas.h"
+#elif defined HAS_ACCELERATE
+  /*	Apple's Accelerate framework - when 'find_blas()' saw the '$NEWLAPACK'
+	entry points (macOS >= 13.3), 'ACCELERATE_NEW_LAPACK' will already be
+	defined, which makes Apple's headers target the modern interface; with
+	'BLAS_ILP64' on top, also map it to their ILP64 opt-in macro */
+  #if defined(ACCELERATE_NEW_LAPACK) && defined(BLAS_ILP64) && !defined(ACCELERATE_LAPACK_ILP64)
+    #define ACCELERATE_LAPACK_ILP64
+  #endif
+  #include <Accelerate/Accelerate.h>
+#elif defined INCL_CBLAS
+  #include "cblas.h"
+#elif defined INCL_BLAS
+  #include "blas.h"
+#else
+
+/*	No vendor header was found - the level-scoped modules will declare their
+	slice of the cblas catalog themselves (which might be unreliable); define
+	here the types those prototypes need.
+	Most of this is copy-paste from OpenBLAS with automatic substitutions
+	https://github.com/xianyi/OpenBLAS */
+#define FINDBLAS_OWN_PROTOTYPES
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if !defined(_FINDBLAS_MOCK_DEFINE) && !defined(CBLAS_H)
+#include <stddef.h>
+#define CBLAS_H
+#define CBLAS_INDEX size_t
+typedef enum CBLAS_ORDER     {CblasRowMajor=101, CblasColMajor=102} CBLAS_ORDER;
+typedef enum CBLAS_TRANSPOSE {CblasNoTrans=111, CblasTrans=112, CblasConjTrans=113, CblasConjNoTrans=114} CBLAS_TRANSPOSE;
+typedef enum CBLAS_UPLO      {CblasUpper=121, CblasLower=122} CBLAS_UPLO;
+typedef enum CBLAS_DIAG      {CblasNonUnit=131, CblasUnit=132} CBLAS_DIAG;
+typedef enum CBLAS_SIDE      {CblasLeft=141, CblasRight=142} CBLAS_SIDE;
+
+/* Inclusion of a standard header file is needed for definition of __STDC_*
+   predefined macros with some compilers (e.g. GCC 4.7 on Linux).  This occurs
+   as a side effect of including either <features.h> or <stdc-predef.h>. */
+#include <stdio.h>
+
+/* C99 supports complex floating numbers natively, which GCC also offers as an
+   extension since version 3.0.  If neither are available, use a compatible
+   structure as fallback (see Clause 6.2.5.13 of the C99 standard). */
+#if ((defined(__STDC_IEC_559_COMPLEX__) || __STDC_VERSION__ >= 199901L || \
+      (__GNUC__ >= 3 && !defined(__cplusplus))) && !(defined(FORCE_OPENBLAS_COMPLEX_STRUCT))) && !defined(_MSC_VER)
+
+#ifndef __cplusplus
+  #include <complex.h>
+#endif
+  typedef float _Complex openblas_complex_float;
+  typedef double _Complex openblas_complex_double;
+  #define openblas_make_complex_float(real, imag)    ((real) + ((imag) * _Complex_I))
+  #define openblas_make_complex_double(real, imag)   ((real) + ((imag) * _Complex_I))
+  #define openblas_complex_float_real(z)             (creal(z))
+  #define openblas_complex_float_imag(z)             (cimag(z))
+  #define openblas_complex_double_real(z)            (creal(z))
+  #define openblas_complex_double_imag(z)            (cimag(z))
+#else
+  #define OPENBLAS_COMPLEX_STRUCT
+  typedef struct { float real, imag; } openblas_complex_float;
+  typedef struct { double real, imag; } openblas_complex_double;
+  #define openblas_make_complex_float(real, imag)    {(real), (imag)}
+  #define openblas_make_complex_double(real, imag)   {(real), (imag)}
+  #define openblas_complex_float_real(z)             ((z).real)
+  #define openblas_complex_float_imag(z)             ((z).imag)
+  #define openblas_complex_double_real(z)            ((z).real)
+  #define openblas_complex_double_imag(z)            ((z).imag)
+#endif /* OPENBLAS_CONFIG_H */
+#endif /* _FINDBLAS_MOCK_DEFINE */
+
+void cblas_xerbla(int p, char *rout, char *form, ...);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* vendor header dispatch */
+
+/*	Neutral spellings of the cblas enum types, for wrappers that must compile
+	against whichever header was picked above (the shims in "findblas.h").
+	MKL declares these enums as untagged typedefs ('typedef enum {...}
+	CBLAS_LAYOUT'), so the tagged 'enum CBLAS_ORDER' form does not name a type
+	there; GSL conversely declares only the tagged enums and no typedefs.
+	Everything else provides both. */
+#ifndef FINDBLAS_CBLAS_ENUMS_DEFINED
+#define FINDBLAS_CBLAS_ENUMS_DEFINED
+#ifdef GSL_OWN_INCL_CBLAS
+typedef enum CBLAS_ORDER     findblas_cblas_order;
+typedef enum CBLAS_TRANSPOSE findblas_cblas_transpose;
+typedef enum CBLAS_UPLO      findblas_cblas_uplo;
+typedef enum CBLAS_DIAG      findblas_cblas_diag;
+typedef enum CBLAS_SIDE      findblas_cblas_side;
+#else
+typedef CBLAS_ORDER     findblas_cblas_order;
+typedef CBLAS_TRANSPOSE findblas_cblas_transpose;
+typedef CBLAS_UPLO      findblas_cblas_uplo;
+typedef CBLAS_DIAG      findblas_cblas_diag;
+typedef CBLAS_SIDE      findblas_cblas_side;
+#endif
+#endif /* FINDBLAS_CBLAS_ENUMS_DEFINED */
+
+#endif /* FINDBLAS_COMMON_H */
@@ -0,0 +1,1808 @@
+/*	https://www.github.com/david-cortes/findblas
+	Opt-in runtime dispatch layer for the cblas catalog (enabled by defining
+	'FINDBLAS_RUNTIME_DISPATCH' before including "findblas.h", or by including
+	this file directly). Instead of linking against the library that was found
+	at build time, each routine is resolved lazily on first call through
+	'dlopen'/'dlsym' against a priority-ordered list of candidate libraries,
+	and the resolved pointer is cached in a function-local static, so the
+	steady-state overhead per call is a single indirect jump.
+
+	The lookup order can be overridden by setting the environment variable
+	'FINDBLAS_DISPATCH_LIBRARY' to the full path of the desired library.
+
+	Note: do not include a vendor cblas header alongside this one - the
+	wrappers here take the place of the 'cblas_*' declarations.
+	*/
+#ifndef FINDBLAS_DISPATCH_H
+#define FINDBLAS_DISPATCH_H
+
+/*	Integer type for indices and dimensions - see the note in "findblas.h" */
+#ifndef FINDBLAS_INT_DEFINED
+#define FINDBLAS_INT_DEFINED
+#if defined(BLAS_ILP64) || defined(FINDBLAS_ILP64)
+typedef long long findblas_int;
+#else
+typedef int findblas_int;
+#endif
+#endif
+
+/*	The candidate sonames and symbol names below are all LP64 - dispatching an
+	ILP64 build through them would silently pass 64-bit integers into a
+	32-bit-integer ABI. The ILP64 libraries suffix their symbols
+	('cblas_ddot64_' in 'libopenblas64_') or pick the integer width through a
+	load-time interface layer (MKL's 'mkl_rt'), neither of which this
+	dispatcher handles - link the ILP64 library directly instead. */
+#if defined(BLAS_ILP64) || defined(FINDBLAS_ILP64)
+#error "FINDBLAS_RUNTIME_DISPATCH supports only the LP64 interface - drop BLAS_ILP64/FINDBLAS_ILP64 or link the ILP64 library at build time"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if !defined(_FINDBLAS_MOCK_DEFINE) && !defined(CBLAS_H)
+#include <stddef.h>
+#define CBLAS_H
+#define CBLAS_INDEX size_t
+typedef enum CBLAS_ORDER     {CblasRowMajor=101, CblasColMajor=102} CBLAS_ORDER;
+typedef enum CBLAS_TRANSPOSE {CblasNoTrans=111, CblasTrans=112, CblasConjTrans=113, CblasConjNoTrans=114} CBLAS_TRANSPOSE;
+typedef enum CBLAS_UPLO      {CblasUpper=121, CblasLower=122} CBLAS_UPLO;
+typedef enum CBLAS_DIAG      {CblasNonUnit=131, CblasUnit=132} CBLAS_DIAG;
+typedef enum CBLAS_SIDE      {CblasLeft=141, CblasRight=142} CBLAS_SIDE;
+
+/* Inclusion of a standard header file is needed for definition of __STDC_*
+   predefined macros with some compilers (e.g. GCC 4.7 on Linux).  This occurs
+   as a side effect of including either <features.h> or <stdc-predef.h>. */
+#include <stdio.h>
+
+/* C99 supports complex floating numbers natively, which GCC also offers as an
+   extension since version 3.0.  If neither are available, use a compatible
+   structure as fallback (see Clause 6.2.5.13 of the C99 standard). */
+#if ((defined(__STDC_IEC_559_COMPLEX__) || __STDC_VERSION__ >= 199901L || \
+      (__GNUC__ >= 3 && !defined(__cplusplus))) && !(defined(FORCE_OPENBLAS_COMPLEX_STRUCT))) && !defined(_MSC_VER)
+
+#ifndef __cplusplus
+  #include <complex.h>
+#endif
+  typedef float _Complex openblas_complex_float;
+  typedef double _Complex openblas_complex_double;
+  #define openblas_make_complex_float(real, imag)    ((real) + ((imag) * _Complex_I))
+  #define openblas_make_complex_double(real, imag)   ((real) + ((imag) * _Complex_I))
+  #define openblas_complex_float_real(z)             (creal(z))
+  #define openblas_complex_float_imag(z)             (cimag(z))
+  #define openblas_complex_double_real(z)            (creal(z))
+  #define openblas_complex_double_imag(z)            (cimag(z))
+#else
+  #define OPENBLAS_COMPLEX_STRUCT
+  typedef struct { float real, imag; } openblas_complex_float;
+  typedef struct { double real, imag; } openblas_complex_double;
+  #define openblas_make_complex_float(real, imag)    {(real), (imag)}
+  #define openblas_make_complex_double(real, imag)   {(real), (imag)}
+  #define openblas_complex_float_real(z)             ((z).real)
+  #define openblas_complex_float_imag(z)             ((z).imag)
+  #define openblas_complex_double_real(z)            ((z).real)
+  #define openblas_complex_double_imag(z)            ((z).imag)
+#endif /* OPENBLAS_CONFIG_H */
+#endif /* _FINDBLAS_MOCK_DEFINE */
+
+#include <stdlib.h>
+#if defined(_WIN32) || defined(_WIN64)
+  #include <windows.h>
+  #define findblas__dlopen(name)        ((void*)LoadLibraryA(name))
+  #define findblas__dlsym(handle, name) ((void*)GetProcAddress((HMODULE)(handle), name))
+#else
+  #include <dlfcn.h>
+  #define findblas__dlopen(name)        dlopen(name, RTLD_NOW | RTLD_GLOBAL)
+  #define findblas__dlsym(handle, name) dlsym(handle, name)
+#endif
+
+/* Priority-ordered candidate list - mirrors the search order used by
+   'find_blas()' on the python side (MKL, then OpenBLAS, BLIS, ATLAS, GSL,
+   then generic names) */
+static const char *findblas__dispatch_candidates[] = {
+#if defined(_WIN32) || defined(_WIN64)
+    "mkl_rt.2.dll", "mkl_rt.1.dll", "mkl_rt.dll",
+    "libopenblas.dll", "openblas.dll",
+    "libblis.dll", "libblis-mt.dll",
+    "libgslcblas.dll",
+    "libcblas.dll", "libblas.dll",
+#elif defined(__APPLE__)
+    "libmkl_rt.dylib",
+    "libopenblas.dylib",
+    "libblis.dylib",
+    "libtatlas.dylib", "libsatlas.dylib", "libatlas.dylib",
+    "libgslcblas.dylib",
+    "libcblas.dylib", "libblas.dylib",
+#else
+    "libmkl_rt.so", "libmkl_rt.so.2", "libmkl_rt.so.1",
+    "libarmpl.so", "libarmpl_lp64_mp.so",
+    "libnvpl_blas_lp64_gomp.so.0", "libnvpl_blas_lp64_seq.so.0",
+    "libopenblas.so", "libopenblas.so.0",
+    "libblis.so", "libblis-mt.so",
+    "libtatlas.so", "libsatlas.so", "libatlas.so",
+    "libgslcblas.so",
+    "libcblas.so", "libblas.so", "libblas.so.3",
+#endif
+    NULL
+};
+
+static void *findblas__dispatch_handle = NULL;
+
+static inline void *findblas__dispatch_open(void)
+{
+    const char *override_lib;
+    int ix;
+    if (findblas__dispatch_handle != NULL)
+        return findblas__dispatch_handle;
+    override_lib = getenv("FINDBLAS_DISPATCH_LIBRARY");
+    if (override_lib != NULL && override_lib[0] != '\0')
+        findblas__dispatch_handle = findblas__dlopen(override_lib);
+    for (ix = 0; findblas__dispatch_handle == NULL &&
+                 findblas__dispatch_candidates[ix] != NULL; ix++)
+        findblas__dispatch_handle = findblas__dlopen(findblas__dispatch_candidates[ix]);
+    if (findblas__dispatch_handle == NULL) {
+        fprintf(stderr, "findblas: could not load any BLAS library for runtime dispatch\n");
+        exit(1);
+    }
+    return findblas__dispatch_handle;
+}
+
+static inline void *findblas__dispatch_sym(const char *name)
+{
+    void *ptr = findblas__dlsym(findblas__dispatch_open(), name);
+    if (ptr == NULL) {
+        fprintf(stderr, "findblas: symbol '%s' not found in dispatched BLAS library\n", name);
+        exit(1);
+    }
+    return ptr;
+}
+
+/*	variant for the optional extension routines ('?gemm3m', '?axpby',
+	'?omatcopy'/'?imatcopy') - those have composed fallbacks in their
+	wrappers below, same as the linked build gets from "findblas_ext.h" /
+	"findblas_level3.h", so a missing symbol is not an error */
+static inline void *findblas__dispatch_sym_opt(const char *name)
+{
+    return findblas__dlsym(findblas__dispatch_open(), name);
+}
+
+static inline float cblas_sdsdot(const findblas_int n, const float alpha, const float *x, const findblas_int incx, const float *y, const findblas_int incy)
+{
+    typedef float (*findblas__fptr_t)(const findblas_int, const float, const float *, const findblas_int, const float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_sdsdot");
+    return fptr(n, alpha, x, incx, y, incy);
+}
+
+static inline double cblas_dsdot(const findblas_int n, const float *x, const findblas_int incx, const float *y, const findblas_int incy)
+{
+    typedef double (*findblas__fptr_t)(const findblas_int, const float *, const findblas_int, const float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dsdot");
+    return fptr(n, x, incx, y, incy);
+}
+
+static inline float cblas_sdot(const findblas_int n, const float  *x, const findblas_int incx, const float  *y, const findblas_int incy)
+{
+    typedef float (*findblas__fptr_t)(const findblas_int, const float  *, const findblas_int, const float  *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_sdot");
+    return fptr(n, x, incx, y, incy);
+}
+
+static inline double cblas_ddot(const findblas_int n, const double *x, const findblas_int incx, const double *y, const findblas_int incy)
+{
+    typedef double (*findblas__fptr_t)(const findblas_int, const double *, const findblas_int, const double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ddot");
+    return fptr(n, x, incx, y, incy);
+}
+
+static inline openblas_complex_float cblas_cdotu(const findblas_int n, const float  *x, const findblas_int incx, const float  *y, const findblas_int incy)
+{
+    typedef openblas_complex_float (*findblas__fptr_t)(const findblas_int, const float  *, const findblas_int, const float  *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_cdotu");
+    return fptr(n, x, incx, y, incy);
+}
+
+static inline openblas_complex_float cblas_cdotc(const findblas_int n, const float  *x, const findblas_int incx, const float  *y, const findblas_int incy)
+{
+    typedef openblas_complex_float (*findblas__fptr_t)(const findblas_int, const float  *, const findblas_int, const float  *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_cdotc");
+    return fptr(n, x, incx, y, incy);
+}
+
+static inline openblas_complex_double cblas_zdotu(const findblas_int n, const double *x, const findblas_int incx, const double *y, const findblas_int incy)
+{
+    typedef openblas_complex_double (*findblas__fptr_t)(const findblas_int, const double *, const findblas_int, const double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zdotu");
+    return fptr(n, x, incx, y, incy);
+}
+
+static inline openblas_complex_double cblas_zdotc(const findblas_int n, const double *x, const findblas_int incx, const double *y, const findblas_int incy)
+{
+    typedef openblas_complex_double (*findblas__fptr_t)(const findblas_int, const double *, const findblas_int, const double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zdotc");
+    return fptr(n, x, incx, y, incy);
+}
+
+static inline void cblas_cdotu_sub(const findblas_int n, const float  *x, const findblas_int incx, const float  *y, const findblas_int incy, openblas_complex_float  *ret)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, const float  *, const findblas_int, const float  *, const findblas_int, openblas_complex_float  *);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_cdotu_sub");
+    fptr(n, x, incx, y, incy, ret);
+}
+
+static inline void cblas_cdotc_sub(const findblas_int n, const float  *x, const findblas_int incx, const float  *y, const findblas_int incy, openblas_complex_float  *ret)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, const float  *, const findblas_int, const float  *, const findblas_int, openblas_complex_float  *);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_cdotc_sub");
+    fptr(n, x, incx, y, incy, ret);
+}
+
+static inline void cblas_zdotu_sub(const findblas_int n, const double *x, const findblas_int incx, const double *y, const findblas_int incy, openblas_complex_double *ret)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, const double *, const findblas_int, const double *, const findblas_int, openblas_complex_double *);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zdotu_sub");
+    fptr(n, x, incx, y, incy, ret);
+}
+
+static inline void cblas_zdotc_sub(const findblas_int n, const double *x, const findblas_int incx, const double *y, const findblas_int incy, openblas_complex_double *ret)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, const double *, const findblas_int, const double *, const findblas_int, openblas_complex_double *);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zdotc_sub");
+    fptr(n, x, incx, y, incy, ret);
+}
+
+static inline float cblas_sasum(const findblas_int n, const float  *x, const findblas_int incx)
+{
+    typedef float (*findblas__fptr_t)(const findblas_int, const float  *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_sasum");
+    return fptr(n, x, incx);
+}
+
+static inline double cblas_dasum(const findblas_int n, const double *x, const findblas_int incx)
+{
+    typedef double (*findblas__fptr_t)(const findblas_int, const double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dasum");
+    return fptr(n, x, incx);
+}
+
+static inline float cblas_scasum(const findblas_int n, const float  *x, const findblas_int incx)
+{
+    typedef float (*findblas__fptr_t)(const findblas_int, const float  *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_scasum");
+    return fptr(n, x, incx);
+}
+
+static inline double cblas_dzasum(const findblas_int n, const double *x, const findblas_int incx)
+{
+    typedef double (*findblas__fptr_t)(const findblas_int, const double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dzasum");
+    return fptr(n, x, incx);
+}
+
+static inline float cblas_snrm2(const findblas_int N, const float  *X, const findblas_int incX)
+{
+    typedef float (*findblas__fptr_t)(const findblas_int, const float  *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_snrm2");
+    return fptr(N, X, incX);
+}
+
+static inline double cblas_dnrm2(const findblas_int N, const double *X, const findblas_int incX)
+{
+    typedef double (*findblas__fptr_t)(const findblas_int, const double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dnrm2");
+    return fptr(N, X, incX);
+}
+
+static inline float cblas_scnrm2(const findblas_int N, const float  *X, const findblas_int incX)
+{
+    typedef float (*findblas__fptr_t)(const findblas_int, const float  *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_scnrm2");
+    return fptr(N, X, incX);
+}
+
+static inline double cblas_dznrm2(const findblas_int N, const double *X, const findblas_int incX)
+{
+    typedef double (*findblas__fptr_t)(const findblas_int, const double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dznrm2");
+    return fptr(N, X, incX);
+}
+
+static inline CBLAS_INDEX cblas_isamax(const findblas_int n, const float  *x, const findblas_int incx)
+{
+    typedef CBLAS_INDEX (*findblas__fptr_t)(const findblas_int, const float  *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_isamax");
+    return fptr(n, x, incx);
+}
+
+static inline CBLAS_INDEX cblas_idamax(const findblas_int n, const double *x, const findblas_int incx)
+{
+    typedef CBLAS_INDEX (*findblas__fptr_t)(const findblas_int, const double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_idamax");
+    return fptr(n, x, incx);
+}
+
+static inline CBLAS_INDEX cblas_icamax(const findblas_int n, const float  *x, const findblas_int incx)
+{
+    typedef CBLAS_INDEX (*findblas__fptr_t)(const findblas_int, const float  *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_icamax");
+    return fptr(n, x, incx);
+}
+
+static inline CBLAS_INDEX cblas_izamax(const findblas_int n, const double *x, const findblas_int incx)
+{
+    typedef CBLAS_INDEX (*findblas__fptr_t)(const findblas_int, const double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_izamax");
+    return fptr(n, x, incx);
+}
+
+static inline void cblas_saxpy(const findblas_int n, const float alpha, const float *x, const findblas_int incx, float *y, const findblas_int incy)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, const float, const float *, const findblas_int, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_saxpy");
+    fptr(n, alpha, x, incx, y, incy);
+}
+
+static inline void cblas_daxpy(const findblas_int n, const double alpha, const double *x, const findblas_int incx, double *y, const findblas_int incy)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, const double, const double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_daxpy");
+    fptr(n, alpha, x, incx, y, incy);
+}
+
+static inline void cblas_caxpy(const findblas_int n, const float *alpha, const float *x, const findblas_int incx, float *y, const findblas_int incy)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, const float *, const float *, const findblas_int, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_caxpy");
+    fptr(n, alpha, x, incx, y, incy);
+}
+
+static inline void cblas_zaxpy(const findblas_int n, const double *alpha, const double *x, const findblas_int incx, double *y, const findblas_int incy)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, const double *, const double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zaxpy");
+    fptr(n, alpha, x, incx, y, incy);
+}
+
+static inline void cblas_scopy(const findblas_int n, const float *x, const findblas_int incx, float *y, const findblas_int incy)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, const float *, const findblas_int, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_scopy");
+    fptr(n, x, incx, y, incy);
+}
+
+static inline void cblas_dcopy(const findblas_int n, const double *x, const findblas_int incx, double *y, const findblas_int incy)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, const double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dcopy");
+    fptr(n, x, incx, y, incy);
+}
+
+static inline void cblas_ccopy(const findblas_int n, const float *x, const findblas_int incx, float *y, const findblas_int incy)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, const float *, const findblas_int, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ccopy");
+    fptr(n, x, incx, y, incy);
+}
+
+static inline void cblas_zcopy(const findblas_int n, const double *x, const findblas_int incx, double *y, const findblas_int incy)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, const double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zcopy");
+    fptr(n, x, incx, y, incy);
+}
+
+static inline void cblas_sswap(const findblas_int n, float *x, const findblas_int incx, float *y, const findblas_int incy)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, float *, const findblas_int, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_sswap");
+    fptr(n, x, incx, y, incy);
+}
+
+static inline void cblas_dswap(const findblas_int n, double *x, const findblas_int incx, double *y, const findblas_int incy)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dswap");
+    fptr(n, x, incx, y, incy);
+}
+
+static inline void cblas_cswap(const findblas_int n, float *x, const findblas_int incx, float *y, const findblas_int incy)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, float *, const findblas_int, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_cswap");
+    fptr(n, x, incx, y, incy);
+}
+
+static inline void cblas_zswap(const findblas_int n, double *x, const findblas_int incx, double *y, const findblas_int incy)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zswap");
+    fptr(n, x, incx, y, incy);
+}
+
+static inline void cblas_srot(const findblas_int N, float *X, const findblas_int incX, float *Y, const findblas_int incY, const float c, const float s)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, float *, const findblas_int, float *, const findblas_int, const float, const float);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_srot");
+    fptr(N, X, incX, Y, incY, c, s);
+}
+
+static inline void cblas_drot(const findblas_int N, double *X, const findblas_int incX, double *Y, const findblas_int incY, const double c, const double  s)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, double *, const findblas_int, double *, const findblas_int, const double, const double);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_drot");
+    fptr(N, X, incX, Y, incY, c, s);
+}
+
+static inline void cblas_srotg(float *a, float *b, float *c, float *s)
+{
+    typedef void (*findblas__fptr_t)(float *, float *, float *, float *);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_srotg");
+    fptr(a, b, c, s);
+}
+
+static inline void cblas_drotg(double *a, double *b, double *c, double *s)
+{
+    typedef void (*findblas__fptr_t)(double *, double *, double *, double *);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_drotg");
+    fptr(a, b, c, s);
+}
+
+static inline void cblas_srotm(const findblas_int N, float *X, const findblas_int incX, float *Y, const findblas_int incY, const float *P)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, float *, const findblas_int, float *, const findblas_int, const float *);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_srotm");
+    fptr(N, X, incX, Y, incY, P);
+}
+
+static inline void cblas_drotm(const findblas_int N, double *X, const findblas_int incX, double *Y, const findblas_int incY, const double *P)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, double *, const findblas_int, double *, const findblas_int, const double *);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_drotm");
+    fptr(N, X, incX, Y, incY, P);
+}
+
+static inline void cblas_srotmg(float *d1, float *d2, float *b1, const float b2, float *P)
+{
+    typedef void (*findblas__fptr_t)(float *, float *, float *, const float, float *);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_srotmg");
+    fptr(d1, d2, b1, b2, P);
+}
+
+static inline void cblas_drotmg(double *d1, double *d2, double *b1, const double b2, double *P)
+{
+    typedef void (*findblas__fptr_t)(double *, double *, double *, const double, double *);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_drotmg");
+    fptr(d1, d2, b1, b2, P);
+}
+
+static inline void cblas_sscal(const findblas_int N, const float alpha, float *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, const float, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_sscal");
+    fptr(N, alpha, X, incX);
+}
+
+static inline void cblas_dscal(const findblas_int N, const double alpha, double *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, const double, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dscal");
+    fptr(N, alpha, X, incX);
+}
+
+static inline void cblas_cscal(const findblas_int N, const float *alpha, float *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, const float *, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_cscal");
+    fptr(N, alpha, X, incX);
+}
+
+static inline void cblas_zscal(const findblas_int N, const double *alpha, double *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, const double *, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zscal");
+    fptr(N, alpha, X, incX);
+}
+
+static inline void cblas_csscal(const findblas_int N, const float alpha, float *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, const float, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_csscal");
+    fptr(N, alpha, X, incX);
+}
+
+static inline void cblas_zdscal(const findblas_int N, const double alpha, double *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, const double, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zdscal");
+    fptr(N, alpha, X, incX);
+}
+
+static inline void cblas_sgemv(const enum CBLAS_ORDER order, const enum CBLAS_TRANSPOSE trans, const findblas_int m, const findblas_int n, const float alpha, const float  *a, const findblas_int lda, const float  *x, const findblas_int incx, const float beta, float  *y, const findblas_int incy)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const float, const float  *, const findblas_int, const float  *, const findblas_int, const float, float  *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_sgemv");
+    fptr(order, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+}
+
+static inline void cblas_dgemv(const enum CBLAS_ORDER order, const enum CBLAS_TRANSPOSE trans, const findblas_int m, const findblas_int n, const double alpha, const double  *a, const findblas_int lda, const double  *x, const findblas_int incx, const double beta, double  *y, const findblas_int incy)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const double, const double  *, const findblas_int, const double  *, const findblas_int, const double, double  *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dgemv");
+    fptr(order, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+}
+
+static inline void cblas_cgemv(const enum CBLAS_ORDER order, const enum CBLAS_TRANSPOSE trans, const findblas_int m, const findblas_int n, const float *alpha, const float  *a, const findblas_int lda, const float  *x, const findblas_int incx, const float *beta, float  *y, const findblas_int incy)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const float *, const float  *, const findblas_int, const float  *, const findblas_int, const float *, float  *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_cgemv");
+    fptr(order, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+}
+
+static inline void cblas_zgemv(const enum CBLAS_ORDER order, const enum CBLAS_TRANSPOSE trans, const findblas_int m, const findblas_int n, const double *alpha, const double  *a, const findblas_int lda, const double  *x, const findblas_int incx, const double *beta, double  *y, const findblas_int incy)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const double *, const double  *, const findblas_int, const double  *, const findblas_int, const double *, double  *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zgemv");
+    fptr(order, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+}
+
+static inline void cblas_sger(const enum CBLAS_ORDER order, const findblas_int M, const findblas_int N, const float   alpha, const float  *X, const findblas_int incX, const float  *Y, const findblas_int incY, float  *A, const findblas_int lda)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const findblas_int, const findblas_int, const float, const float  *, const findblas_int, const float  *, const findblas_int, float  *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_sger");
+    fptr(order, M, N, alpha, X, incX, Y, incY, A, lda);
+}
+
+static inline void cblas_dger(const enum CBLAS_ORDER order, const findblas_int M, const findblas_int N, const double  alpha, const double *X, const findblas_int incX, const double *Y, const findblas_int incY, double *A, const findblas_int lda)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const findblas_int, const findblas_int, const double, const double *, const findblas_int, const double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dger");
+    fptr(order, M, N, alpha, X, incX, Y, incY, A, lda);
+}
+
+static inline void cblas_cgeru(const enum CBLAS_ORDER order, const findblas_int M, const findblas_int N, const float  *alpha, const float  *X, const findblas_int incX, const float  *Y, const findblas_int incY, float  *A, const findblas_int lda)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const findblas_int, const findblas_int, const float  *, const float  *, const findblas_int, const float  *, const findblas_int, float  *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_cgeru");
+    fptr(order, M, N, alpha, X, incX, Y, incY, A, lda);
+}
+
+static inline void cblas_cgerc(const enum CBLAS_ORDER order, const findblas_int M, const findblas_int N, const float  *alpha, const float  *X, const findblas_int incX, const float  *Y, const findblas_int incY, float  *A, const findblas_int lda)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const findblas_int, const findblas_int, const float  *, const float  *, const findblas_int, const float  *, const findblas_int, float  *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_cgerc");
+    fptr(order, M, N, alpha, X, incX, Y, incY, A, lda);
+}
+
+static inline void cblas_zgeru(const enum CBLAS_ORDER order, const findblas_int M, const findblas_int N, const double *alpha, const double *X, const findblas_int incX, const double *Y, const findblas_int incY, double *A, const findblas_int lda)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const findblas_int, const findblas_int, const double *, const double *, const findblas_int, const double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zgeru");
+    fptr(order, M, N, alpha, X, incX, Y, incY, A, lda);
+}
+
+static inline void cblas_zgerc(const enum CBLAS_ORDER order, const findblas_int M, const findblas_int N, const double *alpha, const double *X, const findblas_int incX, const double *Y, const findblas_int incY, double *A, const findblas_int lda)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const findblas_int, const findblas_int, const double *, const double *, const findblas_int, const double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zgerc");
+    fptr(order, M, N, alpha, X, incX, Y, incY, A, lda);
+}
+
+static inline void cblas_strsv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const float *A, const findblas_int lda, float *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const float *, const findblas_int, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_strsv");
+    fptr(order, Uplo, TransA, Diag, N, A, lda, X, incX);
+}
+
+static inline void cblas_dtrsv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const double *A, const findblas_int lda, double *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dtrsv");
+    fptr(order, Uplo, TransA, Diag, N, A, lda, X, incX);
+}
+
+static inline void cblas_ctrsv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const float *A, const findblas_int lda, float *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const float *, const findblas_int, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ctrsv");
+    fptr(order, Uplo, TransA, Diag, N, A, lda, X, incX);
+}
+
+static inline void cblas_ztrsv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const double *A, const findblas_int lda, double *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ztrsv");
+    fptr(order, Uplo, TransA, Diag, N, A, lda, X, incX);
+}
+
+static inline void cblas_strmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const float *A, const findblas_int lda, float *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const float *, const findblas_int, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_strmv");
+    fptr(order, Uplo, TransA, Diag, N, A, lda, X, incX);
+}
+
+static inline void cblas_dtrmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const double *A, const findblas_int lda, double *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dtrmv");
+    fptr(order, Uplo, TransA, Diag, N, A, lda, X, incX);
+}
+
+static inline void cblas_ctrmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const float *A, const findblas_int lda, float *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const float *, const findblas_int, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ctrmv");
+    fptr(order, Uplo, TransA, Diag, N, A, lda, X, incX);
+}
+
+static inline void cblas_ztrmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const double *A, const findblas_int lda, double *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ztrmv");
+    fptr(order, Uplo, TransA, Diag, N, A, lda, X, incX);
+}
+
+static inline void cblas_ssyr(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const float alpha, const float *X, const findblas_int incX, float *A, const findblas_int lda)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const float, const float *, const findblas_int, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ssyr");
+    fptr(order, Uplo, N, alpha, X, incX, A, lda);
+}
+
+static inline void cblas_dsyr(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const double alpha, const double *X, const findblas_int incX, double *A, const findblas_int lda)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const double, const double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dsyr");
+    fptr(order, Uplo, N, alpha, X, incX, A, lda);
+}
+
+static inline void cblas_cher(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const float alpha, const float *X, const findblas_int incX, float *A, const findblas_int lda)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const float, const float *, const findblas_int, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_cher");
+    fptr(order, Uplo, N, alpha, X, incX, A, lda);
+}
+
+static inline void cblas_zher(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const double alpha, const double *X, const findblas_int incX, double *A, const findblas_int lda)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const double, const double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zher");
+    fptr(order, Uplo, N, alpha, X, incX, A, lda);
+}
+
+static inline void cblas_ssyr2(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const float alpha, const float *X, const findblas_int incX, const float *Y, const findblas_int incY, float *A, const findblas_int lda)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const float, const float *, const findblas_int, const float *, const findblas_int, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ssyr2");
+    fptr(order, Uplo, N, alpha, X, incX, Y, incY, A, lda);
+}
+
+static inline void cblas_dsyr2(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const double alpha, const double *X, const findblas_int incX, const double *Y, const findblas_int incY, double *A, const findblas_int lda)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const double, const double *, const findblas_int, const double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dsyr2");
+    fptr(order, Uplo, N, alpha, X, incX, Y, incY, A, lda);
+}
+
+static inline void cblas_cher2(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const float *alpha, const float *X, const findblas_int incX, const float *Y, const findblas_int incY, float *A, const findblas_int lda)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const float *, const float *, const findblas_int, const float *, const findblas_int, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_cher2");
+    fptr(order, Uplo, N, alpha, X, incX, Y, incY, A, lda);
+}
+
+static inline void cblas_zher2(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const double *alpha, const double *X, const findblas_int incX, const double *Y, const findblas_int incY, double *A, const findblas_int lda)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const double *, const double *, const findblas_int, const double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zher2");
+    fptr(order, Uplo, N, alpha, X, incX, Y, incY, A, lda);
+}
+
+static inline void cblas_sgbmv(const enum CBLAS_ORDER order, const enum CBLAS_TRANSPOSE TransA, const findblas_int M, const findblas_int N, const findblas_int KL, const findblas_int KU, const float alpha, const float *A, const findblas_int lda, const float *X, const findblas_int incX, const float beta, float *Y, const findblas_int incY)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const findblas_int, const findblas_int, const float, const float *, const findblas_int, const float *, const findblas_int, const float, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_sgbmv");
+    fptr(order, TransA, M, N, KL, KU, alpha, A, lda, X, incX, beta, Y, incY);
+}
+
+static inline void cblas_dgbmv(const enum CBLAS_ORDER order, const enum CBLAS_TRANSPOSE TransA, const findblas_int M, const findblas_int N, const findblas_int KL, const findblas_int KU, const double alpha, const double *A, const findblas_int lda, const double *X, const findblas_int incX, const double beta, double *Y, const findblas_int incY)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const findblas_int, const findblas_int, const double, const double *, const findblas_int, const double *, const findblas_int, const double, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dgbmv");
+    fptr(order, TransA, M, N, KL, KU, alpha, A, lda, X, incX, beta, Y, incY);
+}
+
+static inline void cblas_cgbmv(const enum CBLAS_ORDER order, const enum CBLAS_TRANSPOSE TransA, const findblas_int M, const findblas_int N, const findblas_int KL, const findblas_int KU, const float *alpha, const float *A, const findblas_int lda, const float *X, const findblas_int incX, const float *beta, float *Y, const findblas_int incY)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const findblas_int, const findblas_int, const float *, const float *, const findblas_int, const float *, const findblas_int, const float *, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_cgbmv");
+    fptr(order, TransA, M, N, KL, KU, alpha, A, lda, X, incX, beta, Y, incY);
+}
+
+static inline void cblas_zgbmv(const enum CBLAS_ORDER order, const enum CBLAS_TRANSPOSE TransA, const findblas_int M, const findblas_int N, const findblas_int KL, const findblas_int KU, const double *alpha, const double *A, const findblas_int lda, const double *X, const findblas_int incX, const double *beta, double *Y, const findblas_int incY)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const findblas_int, const findblas_int, const double *, const double *, const findblas_int, const double *, const findblas_int, const double *, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zgbmv");
+    fptr(order, TransA, M, N, KL, KU, alpha, A, lda, X, incX, beta, Y, incY);
+}
+
+static inline void cblas_ssbmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const findblas_int K, const float alpha, const float *A, const findblas_int lda, const float *X, const findblas_int incX, const float beta, float *Y, const findblas_int incY)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const findblas_int, const float, const float *, const findblas_int, const float *, const findblas_int, const float, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ssbmv");
+    fptr(order, Uplo, N, K, alpha, A, lda, X, incX, beta, Y, incY);
+}
+
+static inline void cblas_dsbmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const findblas_int K, const double alpha, const double *A, const findblas_int lda, const double *X, const findblas_int incX, const double beta, double *Y, const findblas_int incY)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const findblas_int, const double, const double *, const findblas_int, const double *, const findblas_int, const double, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dsbmv");
+    fptr(order, Uplo, N, K, alpha, A, lda, X, incX, beta, Y, incY);
+}
+
+static inline void cblas_stbmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const findblas_int K, const float *A, const findblas_int lda, float *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const findblas_int, const float *, const findblas_int, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_stbmv");
+    fptr(order, Uplo, TransA, Diag, N, K, A, lda, X, incX);
+}
+
+static inline void cblas_dtbmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const findblas_int K, const double *A, const findblas_int lda, double *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const findblas_int, const double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dtbmv");
+    fptr(order, Uplo, TransA, Diag, N, K, A, lda, X, incX);
+}
+
+static inline void cblas_ctbmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const findblas_int K, const float *A, const findblas_int lda, float *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const findblas_int, const float *, const findblas_int, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ctbmv");
+    fptr(order, Uplo, TransA, Diag, N, K, A, lda, X, incX);
+}
+
+static inline void cblas_ztbmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const findblas_int K, const double *A, const findblas_int lda, double *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const findblas_int, const double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ztbmv");
+    fptr(order, Uplo, TransA, Diag, N, K, A, lda, X, incX);
+}
+
+static inline void cblas_stbsv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const findblas_int K, const float *A, const findblas_int lda, float *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const findblas_int, const float *, const findblas_int, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_stbsv");
+    fptr(order, Uplo, TransA, Diag, N, K, A, lda, X, incX);
+}
+
+static inline void cblas_dtbsv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const findblas_int K, const double *A, const findblas_int lda, double *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const findblas_int, const double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dtbsv");
+    fptr(order, Uplo, TransA, Diag, N, K, A, lda, X, incX);
+}
+
+static inline void cblas_ctbsv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const findblas_int K, const float *A, const findblas_int lda, float *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const findblas_int, const float *, const findblas_int, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ctbsv");
+    fptr(order, Uplo, TransA, Diag, N, K, A, lda, X, incX);
+}
+
+static inline void cblas_ztbsv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const findblas_int K, const double *A, const findblas_int lda, double *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const findblas_int, const double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ztbsv");
+    fptr(order, Uplo, TransA, Diag, N, K, A, lda, X, incX);
+}
+
+static inline void cblas_stpmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const float *Ap, float *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const float *, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_stpmv");
+    fptr(order, Uplo, TransA, Diag, N, Ap, X, incX);
+}
+
+static inline void cblas_dtpmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const double *Ap, double *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const double *, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dtpmv");
+    fptr(order, Uplo, TransA, Diag, N, Ap, X, incX);
+}
+
+static inline void cblas_ctpmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const float *Ap, float *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const float *, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ctpmv");
+    fptr(order, Uplo, TransA, Diag, N, Ap, X, incX);
+}
+
+static inline void cblas_ztpmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const double *Ap, double *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const double *, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ztpmv");
+    fptr(order, Uplo, TransA, Diag, N, Ap, X, incX);
+}
+
+static inline void cblas_stpsv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const float *Ap, float *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const float *, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_stpsv");
+    fptr(order, Uplo, TransA, Diag, N, Ap, X, incX);
+}
+
+static inline void cblas_dtpsv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const double *Ap, double *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const double *, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dtpsv");
+    fptr(order, Uplo, TransA, Diag, N, Ap, X, incX);
+}
+
+static inline void cblas_ctpsv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const float *Ap, float *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const float *, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ctpsv");
+    fptr(order, Uplo, TransA, Diag, N, Ap, X, incX);
+}
+
+static inline void cblas_ztpsv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const double *Ap, double *X, const findblas_int incX)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const double *, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ztpsv");
+    fptr(order, Uplo, TransA, Diag, N, Ap, X, incX);
+}
+
+static inline void cblas_ssymv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const float alpha, const float *A, const findblas_int lda, const float *X, const findblas_int incX, const float beta, float *Y, const findblas_int incY)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const float, const float *, const findblas_int, const float *, const findblas_int, const float, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ssymv");
+    fptr(order, Uplo, N, alpha, A, lda, X, incX, beta, Y, incY);
+}
+
+static inline void cblas_dsymv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const double alpha, const double *A, const findblas_int lda, const double *X, const findblas_int incX, const double beta, double *Y, const findblas_int incY)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const double, const double *, const findblas_int, const double *, const findblas_int, const double, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dsymv");
+    fptr(order, Uplo, N, alpha, A, lda, X, incX, beta, Y, incY);
+}
+
+static inline void cblas_chemv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const float *alpha, const float *A, const findblas_int lda, const float *X, const findblas_int incX, const float *beta, float *Y, const findblas_int incY)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const float *, const float *, const findblas_int, const float *, const findblas_int, const float *, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_chemv");
+    fptr(order, Uplo, N, alpha, A, lda, X, incX, beta, Y, incY);
+}
+
+static inline void cblas_zhemv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const double *alpha, const double *A, const findblas_int lda, const double *X, const findblas_int incX, const double *beta, double *Y, const findblas_int incY)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const double *, const double *, const findblas_int, const double *, const findblas_int, const double *, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zhemv");
+    fptr(order, Uplo, N, alpha, A, lda, X, incX, beta, Y, incY);
+}
+
+static inline void cblas_sspmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const float alpha, const float *Ap, const float *X, const findblas_int incX, const float beta, float *Y, const findblas_int incY)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const float, const float *, const float *, const findblas_int, const float, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_sspmv");
+    fptr(order, Uplo, N, alpha, Ap, X, incX, beta, Y, incY);
+}
+
+static inline void cblas_dspmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const double alpha, const double *Ap, const double *X, const findblas_int incX, const double beta, double *Y, const findblas_int incY)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const double, const double *, const double *, const findblas_int, const double, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dspmv");
+    fptr(order, Uplo, N, alpha, Ap, X, incX, beta, Y, incY);
+}
+
+static inline void cblas_sspr(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const float alpha, const float *X, const findblas_int incX, float *Ap)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const float, const float *, const findblas_int, float *);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_sspr");
+    fptr(order, Uplo, N, alpha, X, incX, Ap);
+}
+
+static inline void cblas_dspr(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const double alpha, const double *X, const findblas_int incX, double *Ap)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const double, const double *, const findblas_int, double *);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dspr");
+    fptr(order, Uplo, N, alpha, X, incX, Ap);
+}
+
+static inline void cblas_chpr(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const float alpha, const float *X, const findblas_int incX, float *A)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const float, const float *, const findblas_int, float *);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_chpr");
+    fptr(order, Uplo, N, alpha, X, incX, A);
+}
+
+static inline void cblas_zhpr(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const double alpha, const double *X, const findblas_int incX, double *A)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const double, const double *, const findblas_int, double *);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zhpr");
+    fptr(order, Uplo, N, alpha, X, incX, A);
+}
+
+static inline void cblas_sspr2(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const float alpha, const float *X, const findblas_int incX, const float *Y, const findblas_int incY, float *A)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const float, const float *, const findblas_int, const float *, const findblas_int, float *);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_sspr2");
+    fptr(order, Uplo, N, alpha, X, incX, Y, incY, A);
+}
+
+static inline void cblas_dspr2(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const double alpha, const double *X, const findblas_int incX, const double *Y, const findblas_int incY, double *A)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const double, const double *, const findblas_int, const double *, const findblas_int, double *);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dspr2");
+    fptr(order, Uplo, N, alpha, X, incX, Y, incY, A);
+}
+
+static inline void cblas_chpr2(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const float *alpha, const float *X, const findblas_int incX, const float *Y, const findblas_int incY, float *Ap)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const float *, const float *, const findblas_int, const float *, const findblas_int, float *);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_chpr2");
+    fptr(order, Uplo, N, alpha, X, incX, Y, incY, Ap);
+}
+
+static inline void cblas_zhpr2(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const double *alpha, const double *X, const findblas_int incX, const double *Y, const findblas_int incY, double *Ap)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const double *, const double *, const findblas_int, const double *, const findblas_int, double *);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zhpr2");
+    fptr(order, Uplo, N, alpha, X, incX, Y, incY, Ap);
+}
+
+static inline void cblas_chbmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const findblas_int K, const float *alpha, const float *A, const findblas_int lda, const float *X, const findblas_int incX, const float *beta, float *Y, const findblas_int incY)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const findblas_int, const float *, const float *, const findblas_int, const float *, const findblas_int, const float *, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_chbmv");
+    fptr(order, Uplo, N, K, alpha, A, lda, X, incX, beta, Y, incY);
+}
+
+static inline void cblas_zhbmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const findblas_int K, const double *alpha, const double *A, const findblas_int lda, const double *X, const findblas_int incX, const double *beta, double *Y, const findblas_int incY)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const findblas_int, const double *, const double *, const findblas_int, const double *, const findblas_int, const double *, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zhbmv");
+    fptr(order, Uplo, N, K, alpha, A, lda, X, incX, beta, Y, incY);
+}
+
+static inline void cblas_chpmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const float *alpha, const float *Ap, const float *X, const findblas_int incX, const float *beta, float *Y, const findblas_int incY)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const float *, const float *, const float *, const findblas_int, const float *, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_chpmv");
+    fptr(order, Uplo, N, alpha, Ap, X, incX, beta, Y, incY);
+}
+
+static inline void cblas_zhpmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const double *alpha, const double *Ap, const double *X, const findblas_int incX, const double *beta, double *Y, const findblas_int incY)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const findblas_int, const double *, const double *, const double *, const findblas_int, const double *, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zhpmv");
+    fptr(order, Uplo, N, alpha, Ap, X, incX, beta, Y, incY);
+}
+
+static inline void cblas_sgemm(const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_TRANSPOSE TransB, const findblas_int M, const findblas_int N, const findblas_int K, const float alpha, const float *A, const findblas_int lda, const float *B, const findblas_int ldb, const float beta, float *C, const findblas_int ldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_TRANSPOSE, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const findblas_int, const float, const float *, const findblas_int, const float *, const findblas_int, const float, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_sgemm");
+    fptr(Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static inline void cblas_dgemm(const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_TRANSPOSE TransB, const findblas_int M, const findblas_int N, const findblas_int K, const double alpha, const double *A, const findblas_int lda, const double *B, const findblas_int ldb, const double beta, double *C, const findblas_int ldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_TRANSPOSE, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const findblas_int, const double, const double *, const findblas_int, const double *, const findblas_int, const double, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dgemm");
+    fptr(Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static inline void cblas_cgemm(const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_TRANSPOSE TransB, const findblas_int M, const findblas_int N, const findblas_int K, const float *alpha, const float *A, const findblas_int lda, const float *B, const findblas_int ldb, const float *beta, float *C, const findblas_int ldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_TRANSPOSE, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const findblas_int, const float *, const float *, const findblas_int, const float *, const findblas_int, const float *, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_cgemm");
+    fptr(Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static inline void cblas_cgemm3m(const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_TRANSPOSE TransB, const findblas_int M, const findblas_int N, const findblas_int K, const float *alpha, const float *A, const findblas_int lda, const float *B, const findblas_int ldb, const float *beta, float *C, const findblas_int ldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_TRANSPOSE, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const findblas_int, const float *, const float *, const findblas_int, const float *, const findblas_int, const float *, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    static int resolved = 0;
+    if (!resolved) {
+        fptr = (findblas__fptr_t)findblas__dispatch_sym_opt("cblas_cgemm3m");
+        resolved = 1;
+    }
+    if (fptr != NULL) {
+        fptr(Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+        return;
+    }
+    /* composed fallback when the library lacks this entry point: plain gemm */
+    cblas_cgemm(Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static inline void cblas_zgemm(const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_TRANSPOSE TransB, const findblas_int M, const findblas_int N, const findblas_int K, const double *alpha, const double *A, const findblas_int lda, const double *B, const findblas_int ldb, const double *beta, double *C, const findblas_int ldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_TRANSPOSE, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const findblas_int, const double *, const double *, const findblas_int, const double *, const findblas_int, const double *, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zgemm");
+    fptr(Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static inline void cblas_zgemm3m(const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_TRANSPOSE TransB, const findblas_int M, const findblas_int N, const findblas_int K, const double *alpha, const double *A, const findblas_int lda, const double *B, const findblas_int ldb, const double *beta, double *C, const findblas_int ldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_TRANSPOSE, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const findblas_int, const double *, const double *, const findblas_int, const double *, const findblas_int, const double *, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    static int resolved = 0;
+    if (!resolved) {
+        fptr = (findblas__fptr_t)findblas__dispatch_sym_opt("cblas_zgemm3m");
+        resolved = 1;
+    }
+    if (fptr != NULL) {
+        fptr(Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+        return;
+    }
+    /* composed fallback when the library lacks this entry point: plain gemm */
+    cblas_zgemm(Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static inline void cblas_ssymm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const findblas_int M, const findblas_int N, const float alpha, const float *A, const findblas_int lda, const float *B, const findblas_int ldb, const float beta, float *C, const findblas_int ldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_SIDE, const enum CBLAS_UPLO, const findblas_int, const findblas_int, const float, const float *, const findblas_int, const float *, const findblas_int, const float, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ssymm");
+    fptr(Order, Side, Uplo, M, N, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static inline void cblas_dsymm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const findblas_int M, const findblas_int N, const double alpha, const double *A, const findblas_int lda, const double *B, const findblas_int ldb, const double beta, double *C, const findblas_int ldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_SIDE, const enum CBLAS_UPLO, const findblas_int, const findblas_int, const double, const double *, const findblas_int, const double *, const findblas_int, const double, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dsymm");
+    fptr(Order, Side, Uplo, M, N, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static inline void cblas_csymm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const findblas_int M, const findblas_int N, const float *alpha, const float *A, const findblas_int lda, const float *B, const findblas_int ldb, const float *beta, float *C, const findblas_int ldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_SIDE, const enum CBLAS_UPLO, const findblas_int, const findblas_int, const float *, const float *, const findblas_int, const float *, const findblas_int, const float *, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_csymm");
+    fptr(Order, Side, Uplo, M, N, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static inline void cblas_zsymm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const findblas_int M, const findblas_int N, const double *alpha, const double *A, const findblas_int lda, const double *B, const findblas_int ldb, const double *beta, double *C, const findblas_int ldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_SIDE, const enum CBLAS_UPLO, const findblas_int, const findblas_int, const double *, const double *, const findblas_int, const double *, const findblas_int, const double *, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zsymm");
+    fptr(Order, Side, Uplo, M, N, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static inline void cblas_ssyrk(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans, const findblas_int N, const findblas_int K, const float alpha, const float *A, const findblas_int lda, const float beta, float *C, const findblas_int ldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const float, const float *, const findblas_int, const float, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ssyrk");
+    fptr(Order, Uplo, Trans, N, K, alpha, A, lda, beta, C, ldc);
+}
+
+static inline void cblas_dsyrk(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans, const findblas_int N, const findblas_int K, const double alpha, const double *A, const findblas_int lda, const double beta, double *C, const findblas_int ldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const double, const double *, const findblas_int, const double, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dsyrk");
+    fptr(Order, Uplo, Trans, N, K, alpha, A, lda, beta, C, ldc);
+}
+
+static inline void cblas_csyrk(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans, const findblas_int N, const findblas_int K, const float *alpha, const float *A, const findblas_int lda, const float *beta, float *C, const findblas_int ldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const float *, const float *, const findblas_int, const float *, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_csyrk");
+    fptr(Order, Uplo, Trans, N, K, alpha, A, lda, beta, C, ldc);
+}
+
+static inline void cblas_zsyrk(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans, const findblas_int N, const findblas_int K, const double *alpha, const double *A, const findblas_int lda, const double *beta, double *C, const findblas_int ldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const double *, const double *, const findblas_int, const double *, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zsyrk");
+    fptr(Order, Uplo, Trans, N, K, alpha, A, lda, beta, C, ldc);
+}
+
+static inline void cblas_ssyr2k(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans, const findblas_int N, const findblas_int K, const float alpha, const float *A, const findblas_int lda, const float *B, const findblas_int ldb, const float beta, float *C, const findblas_int ldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const float, const float *, const findblas_int, const float *, const findblas_int, const float, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ssyr2k");
+    fptr(Order, Uplo, Trans, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static inline void cblas_dsyr2k(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans, const findblas_int N, const findblas_int K, const double alpha, const double *A, const findblas_int lda, const double *B, const findblas_int ldb, const double beta, double *C, const findblas_int ldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const double, const double *, const findblas_int, const double *, const findblas_int, const double, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dsyr2k");
+    fptr(Order, Uplo, Trans, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static inline void cblas_csyr2k(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans, const findblas_int N, const findblas_int K, const float *alpha, const float *A, const findblas_int lda, const float *B, const findblas_int ldb, const float *beta, float *C, const findblas_int ldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const float *, const float *, const findblas_int, const float *, const findblas_int, const float *, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_csyr2k");
+    fptr(Order, Uplo, Trans, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static inline void cblas_zsyr2k(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans, const findblas_int N, const findblas_int K, const double *alpha, const double *A, const findblas_int lda, const double *B, const findblas_int ldb, const double *beta, double *C, const findblas_int ldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const double *, const double *, const findblas_int, const double *, const findblas_int, const double *, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zsyr2k");
+    fptr(Order, Uplo, Trans, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static inline void cblas_strmm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int M, const findblas_int N, const float alpha, const float *A, const findblas_int lda, float *B, const findblas_int ldb)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_SIDE, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const findblas_int, const float, const float *, const findblas_int, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_strmm");
+    fptr(Order, Side, Uplo, TransA, Diag, M, N, alpha, A, lda, B, ldb);
+}
+
+static inline void cblas_dtrmm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int M, const findblas_int N, const double alpha, const double *A, const findblas_int lda, double *B, const findblas_int ldb)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_SIDE, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const findblas_int, const double, const double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dtrmm");
+    fptr(Order, Side, Uplo, TransA, Diag, M, N, alpha, A, lda, B, ldb);
+}
+
+static inline void cblas_ctrmm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int M, const findblas_int N, const float *alpha, const float *A, const findblas_int lda, float *B, const findblas_int ldb)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_SIDE, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const findblas_int, const float *, const float *, const findblas_int, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ctrmm");
+    fptr(Order, Side, Uplo, TransA, Diag, M, N, alpha, A, lda, B, ldb);
+}
+
+static inline void cblas_ztrmm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int M, const findblas_int N, const double *alpha, const double *A, const findblas_int lda, double *B, const findblas_int ldb)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_SIDE, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const findblas_int, const double *, const double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ztrmm");
+    fptr(Order, Side, Uplo, TransA, Diag, M, N, alpha, A, lda, B, ldb);
+}
+
+static inline void cblas_strsm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int M, const findblas_int N, const float alpha, const float *A, const findblas_int lda, float *B, const findblas_int ldb)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_SIDE, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const findblas_int, const float, const float *, const findblas_int, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_strsm");
+    fptr(Order, Side, Uplo, TransA, Diag, M, N, alpha, A, lda, B, ldb);
+}
+
+static inline void cblas_dtrsm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int M, const findblas_int N, const double alpha, const double *A, const findblas_int lda, double *B, const findblas_int ldb)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_SIDE, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const findblas_int, const double, const double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dtrsm");
+    fptr(Order, Side, Uplo, TransA, Diag, M, N, alpha, A, lda, B, ldb);
+}
+
+static inline void cblas_ctrsm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int M, const findblas_int N, const float *alpha, const float *A, const findblas_int lda, float *B, const findblas_int ldb)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_SIDE, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const findblas_int, const float *, const float *, const findblas_int, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ctrsm");
+    fptr(Order, Side, Uplo, TransA, Diag, M, N, alpha, A, lda, B, ldb);
+}
+
+static inline void cblas_ztrsm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int M, const findblas_int N, const double *alpha, const double *A, const findblas_int lda, double *B, const findblas_int ldb)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_SIDE, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const enum CBLAS_DIAG, const findblas_int, const findblas_int, const double *, const double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_ztrsm");
+    fptr(Order, Side, Uplo, TransA, Diag, M, N, alpha, A, lda, B, ldb);
+}
+
+static inline void cblas_chemm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const findblas_int M, const findblas_int N, const float *alpha, const float *A, const findblas_int lda, const float *B, const findblas_int ldb, const float *beta, float *C, const findblas_int ldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_SIDE, const enum CBLAS_UPLO, const findblas_int, const findblas_int, const float *, const float *, const findblas_int, const float *, const findblas_int, const float *, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_chemm");
+    fptr(Order, Side, Uplo, M, N, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static inline void cblas_zhemm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const findblas_int M, const findblas_int N, const double *alpha, const double *A, const findblas_int lda, const double *B, const findblas_int ldb, const double *beta, double *C, const findblas_int ldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_SIDE, const enum CBLAS_UPLO, const findblas_int, const findblas_int, const double *, const double *, const findblas_int, const double *, const findblas_int, const double *, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zhemm");
+    fptr(Order, Side, Uplo, M, N, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static inline void cblas_cherk(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans, const findblas_int N, const findblas_int K, const float alpha, const float *A, const findblas_int lda, const float beta, float *C, const findblas_int ldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const float, const float *, const findblas_int, const float, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_cherk");
+    fptr(Order, Uplo, Trans, N, K, alpha, A, lda, beta, C, ldc);
+}
+
+static inline void cblas_zherk(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans, const findblas_int N, const findblas_int K, const double alpha, const double *A, const findblas_int lda, const double beta, double *C, const findblas_int ldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const double, const double *, const findblas_int, const double, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zherk");
+    fptr(Order, Uplo, Trans, N, K, alpha, A, lda, beta, C, ldc);
+}
+
+static inline void cblas_cher2k(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans, const findblas_int N, const findblas_int K, const float *alpha, const float *A, const findblas_int lda, const float *B, const findblas_int ldb, const float beta, float *C, const findblas_int ldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const float *, const float *, const findblas_int, const float *, const findblas_int, const float, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_cher2k");
+    fptr(Order, Uplo, Trans, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static inline void cblas_zher2k(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans, const findblas_int N, const findblas_int K, const double *alpha, const double *A, const findblas_int lda, const double *B, const findblas_int ldb, const double beta, double *C, const findblas_int ldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_UPLO, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const double *, const double *, const findblas_int, const double *, const findblas_int, const double, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zher2k");
+    fptr(Order, Uplo, Trans, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static inline void cblas_saxpby(const findblas_int n, const float alpha, const float *x, const findblas_int incx, const float beta, float *y, const findblas_int incy)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, const float, const float *, const findblas_int, const float, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    static int resolved = 0;
+    if (!resolved) {
+        fptr = (findblas__fptr_t)findblas__dispatch_sym_opt("cblas_saxpby");
+        resolved = 1;
+    }
+    if (fptr != NULL) {
+        fptr(n, alpha, x, incx, beta, y, incy);
+        return;
+    }
+    /* composed fallback when the library lacks this entry point: scal + axpy */
+    cblas_sscal(n, beta, y, incy);
+    cblas_saxpy(n, alpha, x, incx, y, incy);
+}
+
+static inline void cblas_daxpby(const findblas_int n, const double alpha, const double *x, const findblas_int incx, const double beta, double *y, const findblas_int incy)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, const double, const double *, const findblas_int, const double, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    static int resolved = 0;
+    if (!resolved) {
+        fptr = (findblas__fptr_t)findblas__dispatch_sym_opt("cblas_daxpby");
+        resolved = 1;
+    }
+    if (fptr != NULL) {
+        fptr(n, alpha, x, incx, beta, y, incy);
+        return;
+    }
+    /* composed fallback when the library lacks this entry point: scal + axpy */
+    cblas_dscal(n, beta, y, incy);
+    cblas_daxpy(n, alpha, x, incx, y, incy);
+}
+
+static inline void cblas_caxpby(const findblas_int n, const float *alpha, const float *x, const findblas_int incx, const float *beta, float *y, const findblas_int incy)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, const float *, const float *, const findblas_int, const float *, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    static int resolved = 0;
+    if (!resolved) {
+        fptr = (findblas__fptr_t)findblas__dispatch_sym_opt("cblas_caxpby");
+        resolved = 1;
+    }
+    if (fptr != NULL) {
+        fptr(n, alpha, x, incx, beta, y, incy);
+        return;
+    }
+    /* composed fallback when the library lacks this entry point: scal + axpy */
+    cblas_cscal(n, beta, y, incy);
+    cblas_caxpy(n, alpha, x, incx, y, incy);
+}
+
+static inline void cblas_zaxpby(const findblas_int n, const double *alpha, const double *x, const findblas_int incx, const double *beta, double *y, const findblas_int incy)
+{
+    typedef void (*findblas__fptr_t)(const findblas_int, const double *, const double *, const findblas_int, const double *, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    static int resolved = 0;
+    if (!resolved) {
+        fptr = (findblas__fptr_t)findblas__dispatch_sym_opt("cblas_zaxpby");
+        resolved = 1;
+    }
+    if (fptr != NULL) {
+        fptr(n, alpha, x, incx, beta, y, incy);
+        return;
+    }
+    /* composed fallback when the library lacks this entry point: scal + axpy */
+    cblas_zscal(n, beta, y, incy);
+    cblas_zaxpy(n, alpha, x, incx, y, incy);
+}
+
+#ifndef FINDBLAS_TRANS_TILE
+#define FINDBLAS_TRANS_TILE 32
+#endif
+
+static inline void cblas_somatcopy(const enum CBLAS_ORDER CORDER, const enum CBLAS_TRANSPOSE CTRANS, const findblas_int crows, const findblas_int ccols, const float calpha, const float *a, const findblas_int clda, float *b, const findblas_int cldb)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const float, const float *, const findblas_int, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    static int resolved = 0;
+    if (!resolved) {
+        fptr = (findblas__fptr_t)findblas__dispatch_sym_opt("cblas_somatcopy");
+        resolved = 1;
+    }
+    if (fptr != NULL) {
+        fptr(CORDER, CTRANS, crows, ccols, calpha, a, clda, b, cldb);
+        return;
+    }
+    /* composed fallback when the library lacks this entry point - same tiled
+       loops as in "findblas_ext.h" */
+    {
+        const findblas_int rs_a = (CORDER == CblasRowMajor)? clda : 1;
+        const findblas_int cs_a = (CORDER == CblasRowMajor)? 1 : clda;
+        const findblas_int rs_b = (CORDER == CblasRowMajor)? cldb : 1;
+        const findblas_int cs_b = (CORDER == CblasRowMajor)? 1 : cldb;
+        const int do_trans = (CTRANS == CblasTrans) || (CTRANS == CblasConjTrans);
+        const findblas_int rs_dst = do_trans? cs_b : rs_b;
+        const findblas_int cs_dst = do_trans? rs_b : cs_b;
+        findblas_int row, col, rr, cc, row_end, col_end;
+        for (rr = 0; rr < crows; rr += FINDBLAS_TRANS_TILE) {
+            row_end = (rr + FINDBLAS_TRANS_TILE < crows)? (rr + FINDBLAS_TRANS_TILE) : crows;
+            for (cc = 0; cc < ccols; cc += FINDBLAS_TRANS_TILE) {
+                col_end = (cc + FINDBLAS_TRANS_TILE < ccols)? (cc + FINDBLAS_TRANS_TILE) : ccols;
+                for (row = rr; row < row_end; row++)
+                    for (col = cc; col < col_end; col++)
+                        b[row*rs_dst + col*cs_dst] = calpha * a[row*rs_a + col*cs_a];
+            }
+        }
+    }
+}
+
+static inline void cblas_domatcopy(const enum CBLAS_ORDER CORDER, const enum CBLAS_TRANSPOSE CTRANS, const findblas_int crows, const findblas_int ccols, const double calpha, const double *a, const findblas_int clda, double *b, const findblas_int cldb)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const double, const double *, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    static int resolved = 0;
+    if (!resolved) {
+        fptr = (findblas__fptr_t)findblas__dispatch_sym_opt("cblas_domatcopy");
+        resolved = 1;
+    }
+    if (fptr != NULL) {
+        fptr(CORDER, CTRANS, crows, ccols, calpha, a, clda, b, cldb);
+        return;
+    }
+    /* composed fallback when the library lacks this entry point - same tiled
+       loops as in "findblas_ext.h" */
+    {
+        const findblas_int rs_a = (CORDER == CblasRowMajor)? clda : 1;
+        const findblas_int cs_a = (CORDER == CblasRowMajor)? 1 : clda;
+        const findblas_int rs_b = (CORDER == CblasRowMajor)? cldb : 1;
+        const findblas_int cs_b = (CORDER == CblasRowMajor)? 1 : cldb;
+        const int do_trans = (CTRANS == CblasTrans) || (CTRANS == CblasConjTrans);
+        const findblas_int rs_dst = do_trans? cs_b : rs_b;
+        const findblas_int cs_dst = do_trans? rs_b : cs_b;
+        findblas_int row, col, rr, cc, row_end, col_end;
+        for (rr = 0; rr < crows; rr += FINDBLAS_TRANS_TILE) {
+            row_end = (rr + FINDBLAS_TRANS_TILE < crows)? (rr + FINDBLAS_TRANS_TILE) : crows;
+            for (cc = 0; cc < ccols; cc += FINDBLAS_TRANS_TILE) {
+                col_end = (cc + FINDBLAS_TRANS_TILE < ccols)? (cc + FINDBLAS_TRANS_TILE) : ccols;
+                for (row = rr; row < row_end; row++)
+                    for (col = cc; col < col_end; col++)
+                        b[row*rs_dst + col*cs_dst] = calpha * a[row*rs_a + col*cs_a];
+            }
+        }
+    }
+}
+
+static inline void cblas_comatcopy(const enum CBLAS_ORDER CORDER, const enum CBLAS_TRANSPOSE CTRANS, const findblas_int crows, const findblas_int ccols, const float* calpha, const float* a, const findblas_int clda, float*b, const findblas_int cldb)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const float*, const float*, const findblas_int, float*, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    static int resolved = 0;
+    if (!resolved) {
+        fptr = (findblas__fptr_t)findblas__dispatch_sym_opt("cblas_comatcopy");
+        resolved = 1;
+    }
+    if (fptr != NULL) {
+        fptr(CORDER, CTRANS, crows, ccols, calpha, a, clda, b, cldb);
+        return;
+    }
+    /* composed fallback when the library lacks this entry point - same tiled
+       loops as in "findblas_ext.h" */
+    {
+        const findblas_int rs_a = (CORDER == CblasRowMajor)? clda : 1;
+        const findblas_int cs_a = (CORDER == CblasRowMajor)? 1 : clda;
+        const findblas_int rs_b = (CORDER == CblasRowMajor)? cldb : 1;
+        const findblas_int cs_b = (CORDER == CblasRowMajor)? 1 : cldb;
+        const int do_trans = (CTRANS == CblasTrans) || (CTRANS == CblasConjTrans);
+        const int do_conj = (CTRANS == CblasConjTrans) || (CTRANS == CblasConjNoTrans);
+        const findblas_int rs_dst = do_trans? cs_b : rs_b;
+        const findblas_int cs_dst = do_trans? rs_b : cs_b;
+        const float alpha_re = calpha[0];
+        const float alpha_im = calpha[1];
+        const float conj_sign = do_conj? -1 : 1;
+        findblas_int row, col, rr, cc, row_end, col_end, ix_src, ix_dst;
+        float x_re, x_im;
+        for (rr = 0; rr < crows; rr += FINDBLAS_TRANS_TILE) {
+            row_end = (rr + FINDBLAS_TRANS_TILE < crows)? (rr + FINDBLAS_TRANS_TILE) : crows;
+            for (cc = 0; cc < ccols; cc += FINDBLAS_TRANS_TILE) {
+                col_end = (cc + FINDBLAS_TRANS_TILE < ccols)? (cc + FINDBLAS_TRANS_TILE) : ccols;
+                for (row = rr; row < row_end; row++)
+                    for (col = cc; col < col_end; col++) {
+                        ix_src = row*rs_a + col*cs_a;
+                        ix_dst = row*rs_dst + col*cs_dst;
+                        x_re = a[2*ix_src];
+                        x_im = conj_sign * a[2*ix_src + 1];
+                        b[2*ix_dst] = alpha_re*x_re - alpha_im*x_im;
+                        b[2*ix_dst + 1] = alpha_re*x_im + alpha_im*x_re;
+                    }
+            }
+        }
+    }
+}
+
+static inline void cblas_zomatcopy(const enum CBLAS_ORDER CORDER, const enum CBLAS_TRANSPOSE CTRANS, const findblas_int crows, const findblas_int ccols, const double* calpha, const double* a, const findblas_int clda, double *b, const findblas_int cldb)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const double*, const double*, const findblas_int, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    static int resolved = 0;
+    if (!resolved) {
+        fptr = (findblas__fptr_t)findblas__dispatch_sym_opt("cblas_zomatcopy");
+        resolved = 1;
+    }
+    if (fptr != NULL) {
+        fptr(CORDER, CTRANS, crows, ccols, calpha, a, clda, b, cldb);
+        return;
+    }
+    /* composed fallback when the library lacks this entry point - same tiled
+       loops as in "findblas_ext.h" */
+    {
+        const findblas_int rs_a = (CORDER == CblasRowMajor)? clda : 1;
+        const findblas_int cs_a = (CORDER == CblasRowMajor)? 1 : clda;
+        const findblas_int rs_b = (CORDER == CblasRowMajor)? cldb : 1;
+        const findblas_int cs_b = (CORDER == CblasRowMajor)? 1 : cldb;
+        const int do_trans = (CTRANS == CblasTrans) || (CTRANS == CblasConjTrans);
+        const int do_conj = (CTRANS == CblasConjTrans) || (CTRANS == CblasConjNoTrans);
+        const findblas_int rs_dst = do_trans? cs_b : rs_b;
+        const findblas_int cs_dst = do_trans? rs_b : cs_b;
+        const double alpha_re = calpha[0];
+        const double alpha_im = calpha[1];
+        const double conj_sign = do_conj? -1 : 1;
+        findblas_int row, col, rr, cc, row_end, col_end, ix_src, ix_dst;
+        double x_re, x_im;
+        for (rr = 0; rr < crows; rr += FINDBLAS_TRANS_TILE) {
+            row_end = (rr + FINDBLAS_TRANS_TILE < crows)? (rr + FINDBLAS_TRANS_TILE) : crows;
+            for (cc = 0; cc < ccols; cc += FINDBLAS_TRANS_TILE) {
+                col_end = (cc + FINDBLAS_TRANS_TILE < ccols)? (cc + FINDBLAS_TRANS_TILE) : ccols;
+                for (row = rr; row < row_end; row++)
+                    for (col = cc; col < col_end; col++) {
+                        ix_src = row*rs_a + col*cs_a;
+                        ix_dst = row*rs_dst + col*cs_dst;
+                        x_re = a[2*ix_src];
+                        x_im = conj_sign * a[2*ix_src + 1];
+                        b[2*ix_dst] = alpha_re*x_re - alpha_im*x_im;
+                        b[2*ix_dst + 1] = alpha_re*x_im + alpha_im*x_re;
+                    }
+            }
+        }
+    }
+}
+
+static inline void cblas_simatcopy(const enum CBLAS_ORDER CORDER, const enum CBLAS_TRANSPOSE CTRANS, const findblas_int crows, const findblas_int ccols, const float calpha, float *a, const findblas_int clda, const findblas_int cldb)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const float, float *, const findblas_int, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    static int resolved = 0;
+    if (!resolved) {
+        fptr = (findblas__fptr_t)findblas__dispatch_sym_opt("cblas_simatcopy");
+        resolved = 1;
+    }
+    if (fptr != NULL) {
+        fptr(CORDER, CTRANS, crows, ccols, calpha, a, clda, cldb);
+        return;
+    }
+    /* composed fallback when the library lacks this entry point - out-of-place
+       copy into a scratch buffer, then copy back with the new leading
+       dimension, same as in "findblas_ext.h" (silently a no-op if the scratch
+       allocation fails) */
+    {
+        const int do_trans = (CTRANS == CblasTrans) || (CTRANS == CblasConjTrans);
+        const findblas_int rows_out = do_trans? ccols : crows;
+        const findblas_int cols_out = do_trans? crows : ccols;
+        const findblas_int ld_tmp = (CORDER == CblasRowMajor)? cols_out : rows_out;
+        const findblas_int rs_t = (CORDER == CblasRowMajor)? ld_tmp : 1;
+        const findblas_int cs_t = (CORDER == CblasRowMajor)? 1 : ld_tmp;
+        const findblas_int rs_d = (CORDER == CblasRowMajor)? cldb : 1;
+        const findblas_int cs_d = (CORDER == CblasRowMajor)? 1 : cldb;
+        findblas_int row, col;
+        float *tmp = (float*)malloc((size_t)rows_out * (size_t)cols_out * sizeof(float));
+        if (tmp == NULL)
+            return;
+        cblas_somatcopy(CORDER, CTRANS, crows, ccols, calpha, a, clda, tmp, ld_tmp);
+        for (row = 0; row < rows_out; row++)
+            for (col = 0; col < cols_out; col++)
+                a[row*rs_d + col*cs_d] = tmp[row*rs_t + col*cs_t];
+        free(tmp);
+    }
+}
+
+static inline void cblas_dimatcopy(const enum CBLAS_ORDER CORDER, const enum CBLAS_TRANSPOSE CTRANS, const findblas_int crows, const findblas_int ccols, const double calpha, double *a, const findblas_int clda, const findblas_int cldb)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const double, double *, const findblas_int, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    static int resolved = 0;
+    if (!resolved) {
+        fptr = (findblas__fptr_t)findblas__dispatch_sym_opt("cblas_dimatcopy");
+        resolved = 1;
+    }
+    if (fptr != NULL) {
+        fptr(CORDER, CTRANS, crows, ccols, calpha, a, clda, cldb);
+        return;
+    }
+    /* composed fallback when the library lacks this entry point - out-of-place
+       copy into a scratch buffer, then copy back with the new leading
+       dimension, same as in "findblas_ext.h" (silently a no-op if the scratch
+       allocation fails) */
+    {
+        const int do_trans = (CTRANS == CblasTrans) || (CTRANS == CblasConjTrans);
+        const findblas_int rows_out = do_trans? ccols : crows;
+        const findblas_int cols_out = do_trans? crows : ccols;
+        const findblas_int ld_tmp = (CORDER == CblasRowMajor)? cols_out : rows_out;
+        const findblas_int rs_t = (CORDER == CblasRowMajor)? ld_tmp : 1;
+        const findblas_int cs_t = (CORDER == CblasRowMajor)? 1 : ld_tmp;
+        const findblas_int rs_d = (CORDER == CblasRowMajor)? cldb : 1;
+        const findblas_int cs_d = (CORDER == CblasRowMajor)? 1 : cldb;
+        findblas_int row, col;
+        double *tmp = (double*)malloc((size_t)rows_out * (size_t)cols_out * sizeof(double));
+        if (tmp == NULL)
+            return;
+        cblas_domatcopy(CORDER, CTRANS, crows, ccols, calpha, a, clda, tmp, ld_tmp);
+        for (row = 0; row < rows_out; row++)
+            for (col = 0; col < cols_out; col++)
+                a[row*rs_d + col*cs_d] = tmp[row*rs_t + col*cs_t];
+        free(tmp);
+    }
+}
+
+static inline void cblas_cimatcopy(const enum CBLAS_ORDER CORDER, const enum CBLAS_TRANSPOSE CTRANS, const findblas_int crows, const findblas_int ccols, const float* calpha, float* a, const findblas_int clda, const findblas_int cldb)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const float*, float*, const findblas_int, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    static int resolved = 0;
+    if (!resolved) {
+        fptr = (findblas__fptr_t)findblas__dispatch_sym_opt("cblas_cimatcopy");
+        resolved = 1;
+    }
+    if (fptr != NULL) {
+        fptr(CORDER, CTRANS, crows, ccols, calpha, a, clda, cldb);
+        return;
+    }
+    /* composed fallback when the library lacks this entry point - out-of-place
+       copy into a scratch buffer, then copy back with the new leading
+       dimension, same as in "findblas_ext.h" (silently a no-op if the scratch
+       allocation fails) */
+    {
+        const int do_trans = (CTRANS == CblasTrans) || (CTRANS == CblasConjTrans);
+        const findblas_int rows_out = do_trans? ccols : crows;
+        const findblas_int cols_out = do_trans? crows : ccols;
+        const findblas_int ld_tmp = (CORDER == CblasRowMajor)? cols_out : rows_out;
+        const findblas_int rs_t = (CORDER == CblasRowMajor)? ld_tmp : 1;
+        const findblas_int cs_t = (CORDER == CblasRowMajor)? 1 : ld_tmp;
+        const findblas_int rs_d = (CORDER == CblasRowMajor)? cldb : 1;
+        const findblas_int cs_d = (CORDER == CblasRowMajor)? 1 : cldb;
+        findblas_int row, col, ix_src, ix_dst;
+        float *tmp = (float*)malloc((size_t)rows_out * (size_t)cols_out * 2 * sizeof(float));
+        if (tmp == NULL)
+            return;
+        cblas_comatcopy(CORDER, CTRANS, crows, ccols, calpha, a, clda, tmp, ld_tmp);
+        for (row = 0; row < rows_out; row++)
+            for (col = 0; col < cols_out; col++) {
+                ix_src = row*rs_t + col*cs_t;
+                ix_dst = row*rs_d + col*cs_d;
+                a[2*ix_dst] = tmp[2*ix_src];
+                a[2*ix_dst + 1] = tmp[2*ix_src + 1];
+            }
+        free(tmp);
+    }
+}
+
+static inline void cblas_zimatcopy(const enum CBLAS_ORDER CORDER, const enum CBLAS_TRANSPOSE CTRANS, const findblas_int crows, const findblas_int ccols, const double* calpha, double* a, const findblas_int clda, const findblas_int cldb)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const enum CBLAS_TRANSPOSE, const findblas_int, const findblas_int, const double*, double*, const findblas_int, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    static int resolved = 0;
+    if (!resolved) {
+        fptr = (findblas__fptr_t)findblas__dispatch_sym_opt("cblas_zimatcopy");
+        resolved = 1;
+    }
+    if (fptr != NULL) {
+        fptr(CORDER, CTRANS, crows, ccols, calpha, a, clda, cldb);
+        return;
+    }
+    /* composed fallback when the library lacks this entry point - out-of-place
+       copy into a scratch buffer, then copy back with the new leading
+       dimension, same as in "findblas_ext.h" (silently a no-op if the scratch
+       allocation fails) */
+    {
+        const int do_trans = (CTRANS == CblasTrans) || (CTRANS == CblasConjTrans);
+        const findblas_int rows_out = do_trans? ccols : crows;
+        const findblas_int cols_out = do_trans? crows : ccols;
+        const findblas_int ld_tmp = (CORDER == CblasRowMajor)? cols_out : rows_out;
+        const findblas_int rs_t = (CORDER == CblasRowMajor)? ld_tmp : 1;
+        const findblas_int cs_t = (CORDER == CblasRowMajor)? 1 : ld_tmp;
+        const findblas_int rs_d = (CORDER == CblasRowMajor)? cldb : 1;
+        const findblas_int cs_d = (CORDER == CblasRowMajor)? 1 : cldb;
+        findblas_int row, col, ix_src, ix_dst;
+        double *tmp = (double*)malloc((size_t)rows_out * (size_t)cols_out * 2 * sizeof(double));
+        if (tmp == NULL)
+            return;
+        cblas_zomatcopy(CORDER, CTRANS, crows, ccols, calpha, a, clda, tmp, ld_tmp);
+        for (row = 0; row < rows_out; row++)
+            for (col = 0; col < cols_out; col++) {
+                ix_src = row*rs_t + col*cs_t;
+                ix_dst = row*rs_d + col*cs_d;
+                a[2*ix_dst] = tmp[2*ix_src];
+                a[2*ix_dst + 1] = tmp[2*ix_src + 1];
+            }
+        free(tmp);
+    }
+}
+
+static inline void cblas_sgeadd(const enum CBLAS_ORDER CORDER, const findblas_int crows, const findblas_int ccols, const float calpha, float *a, const findblas_int clda, const float cbeta, float *c, const findblas_int cldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const findblas_int, const findblas_int, const float, float *, const findblas_int, const float, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_sgeadd");
+    fptr(CORDER, crows, ccols, calpha, a, clda, cbeta, c, cldc);
+}
+
+static inline void cblas_dgeadd(const enum CBLAS_ORDER CORDER, const findblas_int crows, const findblas_int ccols, const double calpha, double *a, const findblas_int clda, const double cbeta, double *c, const findblas_int cldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const findblas_int, const findblas_int, const double, double *, const findblas_int, const double, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_dgeadd");
+    fptr(CORDER, crows, ccols, calpha, a, clda, cbeta, c, cldc);
+}
+
+static inline void cblas_cgeadd(const enum CBLAS_ORDER CORDER, const findblas_int crows, const findblas_int ccols, const float *calpha, float *a, const findblas_int clda, const float *cbeta, float *c, const findblas_int cldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const findblas_int, const findblas_int, const float *, float *, const findblas_int, const float *, float *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_cgeadd");
+    fptr(CORDER, crows, ccols, calpha, a, clda, cbeta, c, cldc);
+}
+
+static inline void cblas_zgeadd(const enum CBLAS_ORDER CORDER, const findblas_int crows, const findblas_int ccols, const double *calpha, double *a, const findblas_int clda, const double *cbeta, double *c, const findblas_int cldc)
+{
+    typedef void (*findblas__fptr_t)(const enum CBLAS_ORDER, const findblas_int, const findblas_int, const double *, double *, const findblas_int, const double *, double *, const findblas_int);
+    static findblas__fptr_t fptr = NULL;
+    if (fptr == NULL) fptr = (findblas__fptr_t)findblas__dispatch_sym("cblas_zgeadd");
+    fptr(CORDER, crows, ccols, calpha, a, clda, cbeta, c, cldc);
+}
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FINDBLAS_DISPATCH_H */
@@ -0,0 +1,313 @@
+/*	https://www.github.com/david-cortes/findblas
+	BLAS extensions (OpenBLAS/MKL): axpby, out-of-place and in-place matrix
+	copy/transposition, geadd.
+	Standalone - can be included on its own instead of the full "findblas.h"
+	to cut down on the declarations each translation unit has to parse; the
+	vendor-header dispatch lives in "findblas_common.h".
+
+	These entry points are not part of the BLAS standard and not every library
+	ships them - 'find_blas()' probes which ones the found library actually
+	exports and emits the 'HAS_CBLAS_AXPBY' / 'HAS_CBLAS_OMATCOPY' /
+	'HAS_CBLAS_IMATCOPY' flags accordingly; for the ones that are absent,
+	composed fallbacks are provided here so the calls always compile and link.
+	*/
+#ifndef FINDBLAS_EXT_H
+#define FINDBLAS_EXT_H
+
+#include "findblas_common.h"
+#include "findblas_level1.h"
+
+#ifdef FINDBLAS_OWN_PROTOTYPES
+
+#if !defined(HAS_CBLAS_OMATCOPY) || !defined(HAS_CBLAS_IMATCOPY)
+#include <stdlib.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef HAS_CBLAS_AXPBY
+void cblas_saxpby(const findblas_int n, const float alpha, const float *x, const findblas_int incx,const float beta, float *y, const findblas_int incy);
+
+void cblas_daxpby(const findblas_int n, const double alpha, const double *x, const findblas_int incx,const double beta, double *y, const findblas_int incy);
+
+void cblas_caxpby(const findblas_int n, const float *alpha, const float *x, const findblas_int incx,const float *beta, float *y, const findblas_int incy);
+
+void cblas_zaxpby(const findblas_int n, const double *alpha, const double *x, const findblas_int incx,const double *beta, double *y, const findblas_int incy);
+#else
+/*	composed fallbacks when the library lacks these entry points: scal + axpy */
+static inline void cblas_saxpby(const findblas_int n, const float alpha, const float *x, const findblas_int incx, const float beta, float *y, const findblas_int incy)
+{
+    cblas_sscal(n, beta, y, incy);
+    cblas_saxpy(n, alpha, x, incx, y, incy);
+}
+static inline void cblas_daxpby(const findblas_int n, const double alpha, const double *x, const findblas_int incx, const double beta, double *y, const findblas_int incy)
+{
+    cblas_dscal(n, beta, y, incy);
+    cblas_daxpy(n, alpha, x, incx, y, incy);
+}
+static inline void cblas_caxpby(const findblas_int n, const float *alpha, const float *x, const findblas_int incx, const float *beta, float *y, const findblas_int incy)
+{
+    cblas_cscal(n, beta, y, incy);
+    cblas_caxpy(n, alpha, x, incx, y, incy);
+}
+static inline void cblas_zaxpby(const findblas_int n, const double *alpha, const double *x, const findblas_int incx, const double *beta, double *y, const findblas_int incy)
+{
+    cblas_zscal(n, beta, y, incy);
+    cblas_zaxpy(n, alpha, x, incx, y, incy);
+}
+#endif
+
+#ifdef HAS_CBLAS_OMATCOPY
+void cblas_somatcopy(const enum CBLAS_ORDER CORDER, const enum CBLAS_TRANSPOSE CTRANS, const findblas_int crows, const findblas_int ccols, const float calpha, const float *a,
+		     const findblas_int clda, float *b, const findblas_int cldb);
+void cblas_domatcopy(const enum CBLAS_ORDER CORDER, const enum CBLAS_TRANSPOSE CTRANS, const findblas_int crows, const findblas_int ccols, const double calpha, const double *a,
+		     const findblas_int clda, double *b, const findblas_int cldb);
+void cblas_comatcopy(const enum CBLAS_ORDER CORDER, const enum CBLAS_TRANSPOSE CTRANS, const findblas_int crows, const findblas_int ccols, const float* calpha, const float* a,
+		     const findblas_int clda, float*b, const findblas_int cldb);
+void cblas_zomatcopy(const enum CBLAS_ORDER CORDER, const enum CBLAS_TRANSPOSE CTRANS, const findblas_int crows, const findblas_int ccols, const double* calpha, const double* a,
+		     const findblas_int clda,  double *b, const findblas_int cldb);
+#else
+/*	portable fallbacks when the library lacks these entry points
+	('crows'/'ccols' are the dimensions of 'a' in the given storage order).
+	The loops are tiled so that both the reads and the (strided, in the
+	transposing case) writes stay within a cache-sized block - a naive
+	double loop over a big matrix runs at a fraction of memory bandwidth
+	once each written line gets evicted before its neighbour is touched -
+	and the destination strides are resolved up front so the inner loop
+	autovectorizes whenever one side is contiguous. */
+#ifndef FINDBLAS_TRANS_TILE
+#define FINDBLAS_TRANS_TILE 32
+#endif
+static inline void cblas_somatcopy(const enum CBLAS_ORDER CORDER, const enum CBLAS_TRANSPOSE CTRANS, const findblas_int crows, const findblas_int ccols, const float calpha, const float *a,
+		     const findblas_int clda, float *b, const findblas_int cldb)
+{
+    const findblas_int rs_a = (CORDER == CblasRowMajor)? clda : 1;
+    const findblas_int cs_a = (CORDER == CblasRowMajor)? 1 : clda;
+    const findblas_int rs_b = (CORDER == CblasRowMajor)? cldb : 1;
+    const findblas_int cs_b = (CORDER == CblasRowMajor)? 1 : cldb;
+    const int do_trans = (CTRANS == CblasTrans) || (CTRANS == CblasConjTrans);
+    const findblas_int rs_dst = do_trans? cs_b : rs_b;
+    const findblas_int cs_dst = do_trans? rs_b : cs_b;
+    findblas_int row, col, rr, cc, row_end, col_end;
+    for (rr = 0; rr < crows; rr += FINDBLAS_TRANS_TILE) {
+        row_end = (rr + FINDBLAS_TRANS_TILE < crows)? (rr + FINDBLAS_TRANS_TILE) : crows;
+        for (cc = 0; cc < ccols; cc += FINDBLAS_TRANS_TILE) {
+            col_end = (cc + FINDBLAS_TRANS_TILE < ccols)? (cc + FINDBLAS_TRANS_TILE) : ccols;
+            for (row = rr; row < row_end; row++)
+                for (col = cc; col < col_end; col++)
+                    b[row*rs_dst + col*cs_dst] = calpha * a[row*rs_a + col*cs_a];
+        }
+    }
+}
+static inline void cblas_domatcopy(const enum CBLAS_ORDER CORDER, const enum CBLAS_TRANSPOSE CTRANS, const findblas_int crows, const findblas_int ccols, const double calpha, const double *a,
+		     const findblas_int clda, double *b, const findblas_int cldb)
+{
+    const findblas_int rs_a = (CORDER == CblasRowMajor)? clda : 1;
+    const findblas_int cs_a = (CORDER == CblasRowMajor)? 1 : clda;
+    const findblas_int rs_b = (CORDER == CblasRowMajor)? cldb : 1;
+    const findblas_int cs_b = (CORDER == CblasRowMajor)? 1 : cldb;
+    const int do_trans = (CTRANS == CblasTrans) || (CTRANS == CblasConjTrans);
+    const findblas_int rs_dst = do_trans? cs_b : rs_b;
+    const findblas_int cs_dst = do_trans? rs_b : cs_b;
+    findblas_int row, col, rr, cc, row_end, col_end;
+    for (rr = 0; rr < crows; rr += FINDBLAS_TRANS_TILE) {
+        row_end = (rr + FINDBLAS_TRANS_TILE < crows)? (rr + FINDBLAS_TRANS_TILE) : crows;
+        for (cc = 0; cc < ccols; cc += FINDBLAS_TRANS_TILE) {
+            col_end = (cc + FINDBLAS_TRANS_TILE < ccols)? (cc + FINDBLAS_TRANS_TILE) : ccols;
+            for (row = rr; row < row_end; row++)
+                for (col = cc; col < col_end; col++)
+                    b[row*rs_dst + col*cs_dst] = calpha * a[row*rs_a + col*cs_a];
+        }
+    }
+}
+static inline void cblas_comatcopy(const enum CBLAS_ORDER CORDER, const enum CBLAS_TRANSPOSE CTRANS, const findblas_int crows, const findblas_int ccols, const float *calpha, const float *a,
+		     const findblas_int clda, float *b, const findblas_int cldb)
+{
+    const findblas_int rs_a = (CORDER == CblasRowMajor)? clda : 1;
+    const findblas_int cs_a = (CORDER == CblasRowMajor)? 1 : clda;
+    const findblas_int rs_b = (CORDER == CblasRowMajor)? cldb : 1;
+    const findblas_int cs_b = (CORDER == CblasRowMajor)? 1 : cldb;
+    const int do_trans = (CTRANS == CblasTrans) || (CTRANS == CblasConjTrans);
+    const int do_conj = (CTRANS == CblasConjTrans) || (CTRANS == CblasConjNoTrans);
+    const findblas_int rs_dst = do_trans? cs_b : rs_b;
+    const findblas_int cs_dst = do_trans? rs_b : cs_b;
+    const float alpha_re = calpha[0];
+    const float alpha_im = calpha[1];
+    const float conj_sign = do_conj? -1 : 1;
+    findblas_int row, col, rr, cc, row_end, col_end, ix_src, ix_dst;
+    float x_re, x_im;
+    for (rr = 0; rr < crows; rr += FINDBLAS_TRANS_TILE) {
+        row_end = (rr + FINDBLAS_TRANS_TILE < crows)? (rr + FINDBLAS_TRANS_TILE) : crows;
+        for (cc = 0; cc < ccols; cc += FINDBLAS_TRANS_TILE) {
+            col_end = (cc + FINDBLAS_TRANS_TILE < ccols)? (cc + FINDBLAS_TRANS_TILE) : ccols;
+            for (row = rr; row < row_end; row++)
+                for (col = cc; col < col_end; col++) {
+                    ix_src = row*rs_a + col*cs_a;
+                    ix_dst = row*rs_dst + col*cs_dst;
+                    x_re = a[2*ix_src];
+                    x_im = conj_sign * a[2*ix_src + 1];
+                    b[2*ix_dst] = alpha_re*x_re - alpha_im*x_im;
+                    b[2*ix_dst + 1] = alpha_re*x_im + alpha_im*x_re;
+                }
+        }
+    }
+}
+static inline void cblas_zomatcopy(const enum CBLAS_ORDER CORDER, const enum CBLAS_TRANSPOSE CTRANS, const findblas_int crows, const findblas_int ccols, const double *calpha, const double *a,
+		     const findblas_int clda, double *b, const findblas_int cldb)
+{
+    const findblas_int rs_a = (CORDER == CblasRowMajor)? clda : 1;
+    const findblas_int cs_a = (CORDER == CblasRowMajor)? 1 : clda;
+    const findblas_int rs_b = (CORDER == CblasRowMajor)? cldb : 1;
+    const findblas_int cs_b = (CORDER == CblasRowMajor)? 1 : cldb;
+    const int do_trans = (CTRANS == CblasTrans) || (CTRANS == CblasConjTrans);
+    const int do_conj = (CTRANS == CblasConjTrans) || (CTRANS == CblasConjNoTrans);
+    const findblas_int rs_dst = do_trans? cs_b : rs_b;
+    const findblas_int cs_dst = do_trans? rs_b : cs_b;
+    const double alpha_re = calpha[0];
+    const double alpha_im = calpha[1];
+    const double conj_sign = do_conj? -1 : 1;
+    findblas_int row, col, rr, cc, row_end, col_end, ix_src, ix_dst;
+    double x_re, x_im;
+    for (rr = 0; rr < crows; rr += FINDBLAS_TRANS_TILE) {
+        row_end = (rr + FINDBLAS_TRANS_TILE < crows)? (rr + FINDBLAS_TRANS_TILE) : crows;
+        for (cc = 0; cc < ccols; cc += FINDBLAS_TRANS_TILE) {
+            col_end = (cc + FINDBLAS_TRANS_TILE < ccols)? (cc + FINDBLAS_TRANS_TILE) : ccols;
+            for (row = rr; row < row_end; row++)
+                for (col = cc; col < col_end; col++) {
+                    ix_src = row*rs_a + col*cs_a;
+                    ix_dst = row*rs_dst + col*cs_dst;
+                    x_re = a[2*ix_src];
+                    x_im = conj_sign * a[2*ix_src + 1];
+                    b[2*ix_dst] = alpha_re*x_re - alpha_im*x_im;
+                    b[2*ix_dst + 1] = alpha_re*x_im + alpha_im*x_re;
+                }
+        }
+    }
+}
+#endif
+
+#ifdef HAS_CBLAS_IMATCOPY
+void cblas_simatcopy(const enum CBLAS_ORDER CORDER, const enum CBLAS_TRANSPOSE CTRANS, const findblas_int crows, const findblas_int ccols, const float calpha, float *a,
+		     const findblas_int clda, const findblas_int cldb);
+void cblas_dimatcopy(const enum CBLAS_ORDER CORDER, const enum CBLAS_TRANSPOSE CTRANS, const findblas_int crows, const findblas_int ccols, const double calpha, double *a,
+		     const findblas_int clda, const findblas_int cldb);
+void cblas_cimatcopy(const enum CBLAS_ORDER CORDER, const enum CBLAS_TRANSPOSE CTRANS, const findblas_int crows, const findblas_int ccols, const float* calpha, float* a,
+		     const findblas_int clda, const findblas_int cldb);
+void cblas_zimatcopy(const enum CBLAS_ORDER CORDER, const enum CBLAS_TRANSPOSE CTRANS, const findblas_int crows, const findblas_int ccols, const double* calpha, double* a,
+		     const findblas_int clda, const findblas_int cldb);
+#else
+/*	composed fallbacks when the library lacks these entry points: out-of-place
+	copy into a scratch buffer, then copy back with the new leading dimension
+	(silently a no-op if the scratch allocation fails) */
+static inline void cblas_simatcopy(const enum CBLAS_ORDER CORDER, const enum CBLAS_TRANSPOSE CTRANS, const findblas_int crows, const findblas_int ccols, const float calpha, float *a,
+		     const findblas_int clda, const findblas_int cldb)
+{
+    const int do_trans = (CTRANS == CblasTrans) || (CTRANS == CblasConjTrans);
+    const findblas_int rows_out = do_trans? ccols : crows;
+    const findblas_int cols_out = do_trans? crows : ccols;
+    const findblas_int ld_tmp = (CORDER == CblasRowMajor)? cols_out : rows_out;
+    const findblas_int rs_t = (CORDER == CblasRowMajor)? ld_tmp : 1;
+    const findblas_int cs_t = (CORDER == CblasRowMajor)? 1 : ld_tmp;
+    const findblas_int rs_d = (CORDER == CblasRowMajor)? cldb : 1;
+    const findblas_int cs_d = (CORDER == CblasRowMajor)? 1 : cldb;
+    findblas_int row, col;
+    float *tmp = (float*)malloc((size_t)rows_out * (size_t)cols_out * sizeof(float));
+    if (tmp == NULL)
+        return;
+    cblas_somatcopy(CORDER, CTRANS, crows, ccols, calpha, a, clda, tmp, ld_tmp);
+    for (row = 0; row < rows_out; row++)
+        for (col = 0; col < cols_out; col++)
+            a[row*rs_d + col*cs_d] = tmp[row*rs_t + col*cs_t];
+    free(tmp);
+}
+static inline void cblas_dimatcopy(const enum CBLAS_ORDER CORDER, const enum CBLAS_TRANSPOSE CTRANS, const findblas_int crows, const findblas_int ccols, const double calpha, double *a,
+		     const findblas_int clda, const findblas_int cldb)
+{
+    const int do_trans = (CTRANS == CblasTrans) || (CTRANS == CblasConjTrans);
+    const findblas_int rows_out = do_trans? ccols : crows;
+    const findblas_int cols_out = do_trans? crows : ccols;
+    const findblas_int ld_tmp = (CORDER == CblasRowMajor)? cols_out : rows_out;
+    const findblas_int rs_t = (CORDER == CblasRowMajor)? ld_tmp : 1;
+    const findblas_int cs_t = (CORDER == CblasRowMajor)? 1 : ld_tmp;
+    const findblas_int rs_d = (CORDER == CblasRowMajor)? cldb : 1;
+    const findblas_int cs_d = (CORDER == CblasRowMajor)? 1 : cldb;
+    findblas_int row, col;
+    double *tmp = (double*)malloc((size_t)rows_out * (size_t)cols_out * sizeof(double));
+    if (tmp == NULL)
+        return;
+    cblas_domatcopy(CORDER, CTRANS, crows, ccols, calpha, a, clda, tmp, ld_tmp);
+    for (row = 0; row < rows_out; row++)
+        for (col = 0; col < cols_out; col++)
+            a[row*rs_d + col*cs_d] = tmp[row*rs_t + col*cs_t];
+    free(tmp);
+}
+static inline void cblas_cimatcopy(const enum CBLAS_ORDER CORDER, const enum CBLAS_TRANSPOSE CTRANS, const findblas_int crows, const findblas_int ccols, const float *calpha, float *a,
+		     const findblas_int clda, const findblas_int cldb)
+{
+    const int do_trans = (CTRANS == CblasTrans) || (CTRANS == CblasConjTrans);
+    const findblas_int rows_out = do_trans? ccols : crows;
+    const findblas_int cols_out = do_trans? crows : ccols;
+    const findblas_int ld_tmp = (CORDER == CblasRowMajor)? cols_out : rows_out;
+    const findblas_int rs_t = (CORDER == CblasRowMajor)? ld_tmp : 1;
+    const findblas_int cs_t = (CORDER == CblasRowMajor)? 1 : ld_tmp;
+    const findblas_int rs_d = (CORDER == CblasRowMajor)? cldb : 1;
+    const findblas_int cs_d = (CORDER == CblasRowMajor)? 1 : cldb;
+    findblas_int row, col, ix_src, ix_dst;
+    float *tmp = (float*)malloc((size_t)rows_out * (size_t)cols_out * 2 * sizeof(float));
+    if (tmp == NULL)
+        return;
+    cblas_comatcopy(CORDER, CTRANS, crows, ccols, calpha, a, clda, tmp, ld_tmp);
+    for (row = 0; row < rows_out; row++)
+        for (col = 0; col < cols_out; col++) {
+            ix_src = row*rs_t + col*cs_t;
+            ix_dst = row*rs_d + col*cs_d;
+            a[2*ix_dst] = tmp[2*ix_src];
+            a[2*ix_dst + 1] = tmp[2*ix_src + 1];
+        }
+    free(tmp);
+}
+static inline void cblas_zimatcopy(const enum CBLAS_ORDER CORDER, const enum CBLAS_TRANSPOSE CTRANS, const findblas_int crows, const findblas_int ccols, const double *calpha, double *a,
+		     const findblas_int clda, const findblas_int cldb)
+{
+    const int do_trans = (CTRANS == CblasTrans) || (CTRANS == CblasConjTrans);
+    const findblas_int rows_out = do_trans? ccols : crows;
+    const findblas_int cols_out = do_trans? crows : ccols;
+    const findblas_int ld_tmp = (CORDER == CblasRowMajor)? cols_out : rows_out;
+    const findblas_int rs_t = (CORDER == CblasRowMajor)? ld_tmp : 1;
+    const findblas_int cs_t = (CORDER == CblasRowMajor)? 1 : ld_tmp;
+    const findblas_int rs_d = (CORDER == CblasRowMajor)? cldb : 1;
+    const findblas_int cs_d = (CORDER == CblasRowMajor)? 1 : cldb;
+    findblas_int row, col, ix_src, ix_dst;
+    double *tmp = (double*)malloc((size_t)rows_out * (size_t)cols_out * 2 * sizeof(double));
+    if (tmp == NULL)
+        return;
+    cblas_zomatcopy(CORDER, CTRANS, crows, ccols, calpha, a, clda, tmp, ld_tmp);
+    for (row = 0; row < rows_out; row++)
+        for (col = 0; col < cols_out; col++) {
+            ix_src = row*rs_t + col*cs_t;
+            ix_dst = row*rs_d + col*cs_d;
+            a[2*ix_dst] = tmp[2*ix_src];
+            a[2*ix_dst + 1] = tmp[2*ix_src + 1];
+        }
+    free(tmp);
+}
+#endif
+
+void cblas_sgeadd(const enum CBLAS_ORDER CORDER,const findblas_int crows, const findblas_int ccols, const float calpha, float *a, const findblas_int clda, const float cbeta,
+		  float *c, const findblas_int cldc);
+void cblas_dgeadd(const enum CBLAS_ORDER CORDER,const findblas_int crows, const findblas_int ccols, const double calpha, double *a, const findblas_int clda, const double cbeta,
+		  double *c, const findblas_int cldc);
+void cblas_cgeadd(const enum CBLAS_ORDER CORDER,const findblas_int crows, const findblas_int ccols, const float *calpha, float *a, const findblas_int clda, const float *cbeta,
+		  float *c, const findblas_int cldc);
+void cblas_zgeadd(const enum CBLAS_ORDER CORDER,const findblas_int crows, const findblas_int ccols, const double *calpha, double *a, const findblas_int clda, const double *cbeta,
+		  double *c, const findblas_int cldc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FINDBLAS_OWN_PROTOTYPES */
+
+#endif /* FINDBLAS_EXT_H */
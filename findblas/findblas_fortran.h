@@ -0,0 +1,434 @@
+/*	https://www.github.com/david-cortes/findblas
+	Fallback shim for libraries that expose only the Fortran BLAS symbols
+	(names ending in underscores, e.g. 'dgemm_') without the CBLAS layer -
+	i.e. when 'find_blas()' emitted both 'NO_CBLAS' and 'HAS_UNDERSCORES'.
+	Defines static inline 'cblas_*' wrappers over the underscored prototypes,
+	so callers keep the CBLAS API while still getting the optimized vendor
+	kernels. Row-major ordering is handled through the usual transpose-swap
+	dualities (swapping A/B and m/n for 'gemm', flipping side/uplo for the
+	side-based routines, etc.).
+
+	Covers the single- and double-precision real routines of the catalog
+	(the ones that do not require a complex type): level-1, plus 'gemv'/'ger'
+	and the level-3 core ('gemm', 'symm', 'syrk', 'trmm', 'trsm'). Can be
+	suppressed by defining 'FINDBLAS_NO_FORTRAN_SHIM'.
+	*/
+#ifndef FINDBLAS_FORTRAN_H
+#define FINDBLAS_FORTRAN_H
+
+/*	Integer type for indices and dimensions - see the note in "findblas.h" */
+#ifndef FINDBLAS_INT_DEFINED
+#define FINDBLAS_INT_DEFINED
+#if defined(BLAS_ILP64) || defined(FINDBLAS_ILP64)
+typedef long long findblas_int;
+#else
+typedef int findblas_int;
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef CBLAS_H
+#include <stddef.h>
+#define CBLAS_H
+#define CBLAS_INDEX size_t
+typedef enum CBLAS_ORDER     {CblasRowMajor=101, CblasColMajor=102} CBLAS_ORDER;
+typedef enum CBLAS_TRANSPOSE {CblasNoTrans=111, CblasTrans=112, CblasConjTrans=113, CblasConjNoTrans=114} CBLAS_TRANSPOSE;
+typedef enum CBLAS_UPLO      {CblasUpper=121, CblasLower=122} CBLAS_UPLO;
+typedef enum CBLAS_DIAG      {CblasNonUnit=131, CblasUnit=132} CBLAS_DIAG;
+typedef enum CBLAS_SIDE      {CblasLeft=141, CblasRight=142} CBLAS_SIDE;
+#endif
+
+/*** Underscored Fortran prototypes (the symbols actually exported by the library) ***/
+
+float  sdot_ (const findblas_int *n, const float  *x, const findblas_int *incx, const float  *y, const findblas_int *incy);
+double ddot_ (const findblas_int *n, const double *x, const findblas_int *incx, const double *y, const findblas_int *incy);
+float  snrm2_(const findblas_int *n, const float  *x, const findblas_int *incx);
+double dnrm2_(const findblas_int *n, const double *x, const findblas_int *incx);
+float  sasum_(const findblas_int *n, const float  *x, const findblas_int *incx);
+double dasum_(const findblas_int *n, const double *x, const findblas_int *incx);
+findblas_int isamax_(const findblas_int *n, const float  *x, const findblas_int *incx);
+findblas_int idamax_(const findblas_int *n, const double *x, const findblas_int *incx);
+void saxpy_(const findblas_int *n, const float  *alpha, const float  *x, const findblas_int *incx, float  *y, const findblas_int *incy);
+void daxpy_(const findblas_int *n, const double *alpha, const double *x, const findblas_int *incx, double *y, const findblas_int *incy);
+void sscal_(const findblas_int *n, const float  *alpha, float  *x, const findblas_int *incx);
+void dscal_(const findblas_int *n, const double *alpha, double *x, const findblas_int *incx);
+void scopy_(const findblas_int *n, const float  *x, const findblas_int *incx, float  *y, const findblas_int *incy);
+void dcopy_(const findblas_int *n, const double *x, const findblas_int *incx, double *y, const findblas_int *incy);
+void sswap_(const findblas_int *n, float  *x, const findblas_int *incx, float  *y, const findblas_int *incy);
+void dswap_(const findblas_int *n, double *x, const findblas_int *incx, double *y, const findblas_int *incy);
+
+void sgemv_(const char *trans, const findblas_int *m, const findblas_int *n, const float  *alpha, const float  *a, const findblas_int *lda,
+            const float  *x, const findblas_int *incx, const float  *beta, float  *y, const findblas_int *incy);
+void dgemv_(const char *trans, const findblas_int *m, const findblas_int *n, const double *alpha, const double *a, const findblas_int *lda,
+            const double *x, const findblas_int *incx, const double *beta, double *y, const findblas_int *incy);
+void sger_ (const findblas_int *m, const findblas_int *n, const float  *alpha, const float  *x, const findblas_int *incx,
+            const float  *y, const findblas_int *incy, float  *a, const findblas_int *lda);
+void dger_ (const findblas_int *m, const findblas_int *n, const double *alpha, const double *x, const findblas_int *incx,
+            const double *y, const findblas_int *incy, double *a, const findblas_int *lda);
+
+void sgemm_(const char *transa, const char *transb, const findblas_int *m, const findblas_int *n, const findblas_int *k,
+            const float  *alpha, const float  *a, const findblas_int *lda, const float  *b, const findblas_int *ldb,
+            const float  *beta, float  *c, const findblas_int *ldc);
+void dgemm_(const char *transa, const char *transb, const findblas_int *m, const findblas_int *n, const findblas_int *k,
+            const double *alpha, const double *a, const findblas_int *lda, const double *b, const findblas_int *ldb,
+            const double *beta, double *c, const findblas_int *ldc);
+void ssymm_(const char *side, const char *uplo, const findblas_int *m, const findblas_int *n,
+            const float  *alpha, const float  *a, const findblas_int *lda, const float  *b, const findblas_int *ldb,
+            const float  *beta, float  *c, const findblas_int *ldc);
+void dsymm_(const char *side, const char *uplo, const findblas_int *m, const findblas_int *n,
+            const double *alpha, const double *a, const findblas_int *lda, const double *b, const findblas_int *ldb,
+            const double *beta, double *c, const findblas_int *ldc);
+void ssyrk_(const char *uplo, const char *trans, const findblas_int *n, const findblas_int *k,
+            const float  *alpha, const float  *a, const findblas_int *lda, const float  *beta, float  *c, const findblas_int *ldc);
+void dsyrk_(const char *uplo, const char *trans, const findblas_int *n, const findblas_int *k,
+            const double *alpha, const double *a, const findblas_int *lda, const double *beta, double *c, const findblas_int *ldc);
+void strmm_(const char *side, const char *uplo, const char *transa, const char *diag, const findblas_int *m, const findblas_int *n,
+            const float  *alpha, const float  *a, const findblas_int *lda, float  *b, const findblas_int *ldb);
+void dtrmm_(const char *side, const char *uplo, const char *transa, const char *diag, const findblas_int *m, const findblas_int *n,
+            const double *alpha, const double *a, const findblas_int *lda, double *b, const findblas_int *ldb);
+void strsm_(const char *side, const char *uplo, const char *transa, const char *diag, const findblas_int *m, const findblas_int *n,
+            const float  *alpha, const float  *a, const findblas_int *lda, float  *b, const findblas_int *ldb);
+void dtrsm_(const char *side, const char *uplo, const char *transa, const char *diag, const findblas_int *m, const findblas_int *n,
+            const double *alpha, const double *a, const findblas_int *lda, double *b, const findblas_int *ldb);
+
+/*** Helpers for translating the cblas enums to Fortran character arguments ***/
+
+static inline char findblas__trans_char(const enum CBLAS_TRANSPOSE trans)
+{
+    /* conjugation is a no-op for the real-valued routines covered here */
+    return (trans == CblasNoTrans || trans == CblasConjNoTrans)? 'N' : 'T';
+}
+
+static inline char findblas__flip_trans_char(const enum CBLAS_TRANSPOSE trans)
+{
+    return (trans == CblasNoTrans || trans == CblasConjNoTrans)? 'T' : 'N';
+}
+
+static inline char findblas__uplo_char(const enum CBLAS_UPLO uplo)
+{
+    return (uplo == CblasUpper)? 'U' : 'L';
+}
+
+static inline char findblas__flip_uplo_char(const enum CBLAS_UPLO uplo)
+{
+    return (uplo == CblasUpper)? 'L' : 'U';
+}
+
+static inline char findblas__side_char(const enum CBLAS_SIDE side)
+{
+    return (side == CblasLeft)? 'L' : 'R';
+}
+
+static inline char findblas__flip_side_char(const enum CBLAS_SIDE side)
+{
+    return (side == CblasLeft)? 'R' : 'L';
+}
+
+static inline char findblas__diag_char(const enum CBLAS_DIAG diag)
+{
+    return (diag == CblasNonUnit)? 'N' : 'U';
+}
+
+/*** Level 1 ***/
+
+static inline float cblas_sdot(const findblas_int n, const float *x, const findblas_int incx, const float *y, const findblas_int incy)
+{
+    return sdot_(&n, x, &incx, y, &incy);
+}
+
+static inline double cblas_ddot(const findblas_int n, const double *x, const findblas_int incx, const double *y, const findblas_int incy)
+{
+    return ddot_(&n, x, &incx, y, &incy);
+}
+
+static inline float cblas_snrm2(const findblas_int N, const float *X, const findblas_int incX)
+{
+    return snrm2_(&N, X, &incX);
+}
+
+static inline double cblas_dnrm2(const findblas_int N, const double *X, const findblas_int incX)
+{
+    return dnrm2_(&N, X, &incX);
+}
+
+static inline float cblas_sasum(const findblas_int n, const float *x, const findblas_int incx)
+{
+    return sasum_(&n, x, &incx);
+}
+
+static inline double cblas_dasum(const findblas_int n, const double *x, const findblas_int incx)
+{
+    return dasum_(&n, x, &incx);
+}
+
+static inline CBLAS_INDEX cblas_isamax(const findblas_int n, const float *x, const findblas_int incx)
+{
+    if (n < 1) return 0;
+    return (CBLAS_INDEX)(isamax_(&n, x, &incx) - 1); /* Fortran indices are one-based */
+}
+
+static inline CBLAS_INDEX cblas_idamax(const findblas_int n, const double *x, const findblas_int incx)
+{
+    if (n < 1) return 0;
+    return (CBLAS_INDEX)(idamax_(&n, x, &incx) - 1); /* Fortran indices are one-based */
+}
+
+static inline void cblas_saxpy(const findblas_int n, const float alpha, const float *x, const findblas_int incx, float *y, const findblas_int incy)
+{
+    saxpy_(&n, &alpha, x, &incx, y, &incy);
+}
+
+static inline void cblas_daxpy(const findblas_int n, const double alpha, const double *x, const findblas_int incx, double *y, const findblas_int incy)
+{
+    daxpy_(&n, &alpha, x, &incx, y, &incy);
+}
+
+static inline void cblas_sscal(const findblas_int N, const float alpha, float *X, const findblas_int incX)
+{
+    sscal_(&N, &alpha, X, &incX);
+}
+
+static inline void cblas_dscal(const findblas_int N, const double alpha, double *X, const findblas_int incX)
+{
+    dscal_(&N, &alpha, X, &incX);
+}
+
+static inline void cblas_scopy(const findblas_int n, const float *x, const findblas_int incx, float *y, const findblas_int incy)
+{
+    scopy_(&n, x, &incx, y, &incy);
+}
+
+static inline void cblas_dcopy(const findblas_int n, const double *x, const findblas_int incx, double *y, const findblas_int incy)
+{
+    dcopy_(&n, x, &incx, y, &incy);
+}
+
+static inline void cblas_sswap(const findblas_int n, float *x, const findblas_int incx, float *y, const findblas_int incy)
+{
+    sswap_(&n, x, &incx, y, &incy);
+}
+
+static inline void cblas_dswap(const findblas_int n, double *x, const findblas_int incx, double *y, const findblas_int incy)
+{
+    dswap_(&n, x, &incx, y, &incy);
+}
+
+/*** Level 2 ***/
+
+static inline void cblas_sgemv(const enum CBLAS_ORDER order, const enum CBLAS_TRANSPOSE trans, const findblas_int m, const findblas_int n,
+                               const float alpha, const float *a, const findblas_int lda, const float *x, const findblas_int incx,
+                               const float beta, float *y, const findblas_int incy)
+{
+    char trans_char;
+    if (order == CblasColMajor) {
+        trans_char = findblas__trans_char(trans);
+        sgemv_(&trans_char, &m, &n, &alpha, a, &lda, x, &incx, &beta, y, &incy);
+    } else {
+        /* row-major A(m,n) is col-major A^T(n,m) with the same leading dimension */
+        trans_char = findblas__flip_trans_char(trans);
+        sgemv_(&trans_char, &n, &m, &alpha, a, &lda, x, &incx, &beta, y, &incy);
+    }
+}
+
+static inline void cblas_dgemv(const enum CBLAS_ORDER order, const enum CBLAS_TRANSPOSE trans, const findblas_int m, const findblas_int n,
+                               const double alpha, const double *a, const findblas_int lda, const double *x, const findblas_int incx,
+                               const double beta, double *y, const findblas_int incy)
+{
+    char trans_char;
+    if (order == CblasColMajor) {
+        trans_char = findblas__trans_char(trans);
+        dgemv_(&trans_char, &m, &n, &alpha, a, &lda, x, &incx, &beta, y, &incy);
+    } else {
+        trans_char = findblas__flip_trans_char(trans);
+        dgemv_(&trans_char, &n, &m, &alpha, a, &lda, x, &incx, &beta, y, &incy);
+    }
+}
+
+static inline void cblas_sger(const enum CBLAS_ORDER order, const findblas_int M, const findblas_int N, const float alpha,
+                              const float *X, const findblas_int incX, const float *Y, const findblas_int incY, float *A, const findblas_int lda)
+{
+    if (order == CblasColMajor)
+        sger_(&M, &N, &alpha, X, &incX, Y, &incY, A, &lda);
+    else
+        /* row-major A += alpha*x*y' is col-major A^T += alpha*y*x' */
+        sger_(&N, &M, &alpha, Y, &incY, X, &incX, A, &lda);
+}
+
+static inline void cblas_dger(const enum CBLAS_ORDER order, const findblas_int M, const findblas_int N, const double alpha,
+                              const double *X, const findblas_int incX, const double *Y, const findblas_int incY, double *A, const findblas_int lda)
+{
+    if (order == CblasColMajor)
+        dger_(&M, &N, &alpha, X, &incX, Y, &incY, A, &lda);
+    else
+        dger_(&N, &M, &alpha, Y, &incY, X, &incX, A, &lda);
+}
+
+/*** Level 3 ***/
+
+static inline void cblas_sgemm(const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_TRANSPOSE TransB,
+                               const findblas_int M, const findblas_int N, const findblas_int K,
+                               const float alpha, const float *A, const findblas_int lda, const float *B, const findblas_int ldb,
+                               const float beta, float *C, const findblas_int ldc)
+{
+    char transa_char = findblas__trans_char(TransA);
+    char transb_char = findblas__trans_char(TransB);
+    if (Order == CblasColMajor)
+        sgemm_(&transa_char, &transb_char, &M, &N, &K, &alpha, A, &lda, B, &ldb, &beta, C, &ldc);
+    else
+        /* row-major C = op(A)*op(B) is col-major C^T = op(B)^T*op(A)^T */
+        sgemm_(&transb_char, &transa_char, &N, &M, &K, &alpha, B, &ldb, A, &lda, &beta, C, &ldc);
+}
+
+static inline void cblas_dgemm(const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_TRANSPOSE TransB,
+                               const findblas_int M, const findblas_int N, const findblas_int K,
+                               const double alpha, const double *A, const findblas_int lda, const double *B, const findblas_int ldb,
+                               const double beta, double *C, const findblas_int ldc)
+{
+    char transa_char = findblas__trans_char(TransA);
+    char transb_char = findblas__trans_char(TransB);
+    if (Order == CblasColMajor)
+        dgemm_(&transa_char, &transb_char, &M, &N, &K, &alpha, A, &lda, B, &ldb, &beta, C, &ldc);
+    else
+        dgemm_(&transb_char, &transa_char, &N, &M, &K, &alpha, B, &ldb, A, &lda, &beta, C, &ldc);
+}
+
+static inline void cblas_ssymm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo,
+                               const findblas_int M, const findblas_int N,
+                               const float alpha, const float *A, const findblas_int lda, const float *B, const findblas_int ldb,
+                               const float beta, float *C, const findblas_int ldc)
+{
+    char side_char, uplo_char;
+    if (Order == CblasColMajor) {
+        side_char = findblas__side_char(Side);
+        uplo_char = findblas__uplo_char(Uplo);
+        ssymm_(&side_char, &uplo_char, &M, &N, &alpha, A, &lda, B, &ldb, &beta, C, &ldc);
+    } else {
+        side_char = findblas__flip_side_char(Side);
+        uplo_char = findblas__flip_uplo_char(Uplo);
+        ssymm_(&side_char, &uplo_char, &N, &M, &alpha, A, &lda, B, &ldb, &beta, C, &ldc);
+    }
+}
+
+static inline void cblas_dsymm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo,
+                               const findblas_int M, const findblas_int N,
+                               const double alpha, const double *A, const findblas_int lda, const double *B, const findblas_int ldb,
+                               const double beta, double *C, const findblas_int ldc)
+{
+    char side_char, uplo_char;
+    if (Order == CblasColMajor) {
+        side_char = findblas__side_char(Side);
+        uplo_char = findblas__uplo_char(Uplo);
+        dsymm_(&side_char, &uplo_char, &M, &N, &alpha, A, &lda, B, &ldb, &beta, C, &ldc);
+    } else {
+        side_char = findblas__flip_side_char(Side);
+        uplo_char = findblas__flip_uplo_char(Uplo);
+        dsymm_(&side_char, &uplo_char, &N, &M, &alpha, A, &lda, B, &ldb, &beta, C, &ldc);
+    }
+}
+
+static inline void cblas_ssyrk(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans,
+                               const findblas_int N, const findblas_int K,
+                               const float alpha, const float *A, const findblas_int lda, const float beta, float *C, const findblas_int ldc)
+{
+    char uplo_char, trans_char;
+    if (Order == CblasColMajor) {
+        uplo_char = findblas__uplo_char(Uplo);
+        trans_char = findblas__trans_char(Trans);
+    } else {
+        uplo_char = findblas__flip_uplo_char(Uplo);
+        trans_char = findblas__flip_trans_char(Trans);
+    }
+    ssyrk_(&uplo_char, &trans_char, &N, &K, &alpha, A, &lda, &beta, C, &ldc);
+}
+
+static inline void cblas_dsyrk(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans,
+                               const findblas_int N, const findblas_int K,
+                               const double alpha, const double *A, const findblas_int lda, const double beta, double *C, const findblas_int ldc)
+{
+    char uplo_char, trans_char;
+    if (Order == CblasColMajor) {
+        uplo_char = findblas__uplo_char(Uplo);
+        trans_char = findblas__trans_char(Trans);
+    } else {
+        uplo_char = findblas__flip_uplo_char(Uplo);
+        trans_char = findblas__flip_trans_char(Trans);
+    }
+    dsyrk_(&uplo_char, &trans_char, &N, &K, &alpha, A, &lda, &beta, C, &ldc);
+}
+
+static inline void cblas_strmm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo,
+                               const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int M, const findblas_int N,
+                               const float alpha, const float *A, const findblas_int lda, float *B, const findblas_int ldb)
+{
+    char side_char, uplo_char, diag_char = findblas__diag_char(Diag);
+    char trans_char = findblas__trans_char(TransA);
+    if (Order == CblasColMajor) {
+        side_char = findblas__side_char(Side);
+        uplo_char = findblas__uplo_char(Uplo);
+        strmm_(&side_char, &uplo_char, &trans_char, &diag_char, &M, &N, &alpha, A, &lda, B, &ldb);
+    } else {
+        side_char = findblas__flip_side_char(Side);
+        uplo_char = findblas__flip_uplo_char(Uplo);
+        strmm_(&side_char, &uplo_char, &trans_char, &diag_char, &N, &M, &alpha, A, &lda, B, &ldb);
+    }
+}
+
+static inline void cblas_dtrmm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo,
+                               const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int M, const findblas_int N,
+                               const double alpha, const double *A, const findblas_int lda, double *B, const findblas_int ldb)
+{
+    char side_char, uplo_char, diag_char = findblas__diag_char(Diag);
+    char trans_char = findblas__trans_char(TransA);
+    if (Order == CblasColMajor) {
+        side_char = findblas__side_char(Side);
+        uplo_char = findblas__uplo_char(Uplo);
+        dtrmm_(&side_char, &uplo_char, &trans_char, &diag_char, &M, &N, &alpha, A, &lda, B, &ldb);
+    } else {
+        side_char = findblas__flip_side_char(Side);
+        uplo_char = findblas__flip_uplo_char(Uplo);
+        dtrmm_(&side_char, &uplo_char, &trans_char, &diag_char, &N, &M, &alpha, A, &lda, B, &ldb);
+    }
+}
+
+static inline void cblas_strsm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo,
+                               const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int M, const findblas_int N,
+                               const float alpha, const float *A, const findblas_int lda, float *B, const findblas_int ldb)
+{
+    char side_char, uplo_char, diag_char = findblas__diag_char(Diag);
+    char trans_char = findblas__trans_char(TransA);
+    if (Order == CblasColMajor) {
+        side_char = findblas__side_char(Side);
+        uplo_char = findblas__uplo_char(Uplo);
+        strsm_(&side_char, &uplo_char, &trans_char, &diag_char, &M, &N, &alpha, A, &lda, B, &ldb);
+    } else {
+        side_char = findblas__flip_side_char(Side);
+        uplo_char = findblas__flip_uplo_char(Uplo);
+        strsm_(&side_char, &uplo_char, &trans_char, &diag_char, &N, &M, &alpha, A, &lda, B, &ldb);
+    }
+}
+
+static inline void cblas_dtrsm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo,
+                               const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int M, const findblas_int N,
+                               const double alpha, const double *A, const findblas_int lda, double *B, const findblas_int ldb)
+{
+    char side_char, uplo_char, diag_char = findblas__diag_char(Diag);
+    char trans_char = findblas__trans_char(TransA);
+    if (Order == CblasColMajor) {
+        side_char = findblas__side_char(Side);
+        uplo_char = findblas__uplo_char(Uplo);
+        dtrsm_(&side_char, &uplo_char, &trans_char, &diag_char, &M, &N, &alpha, A, &lda, B, &ldb);
+    } else {
+        side_char = findblas__flip_side_char(Side);
+        uplo_char = findblas__flip_uplo_char(Uplo);
+        dtrsm_(&side_char, &uplo_char, &trans_char, &diag_char, &N, &M, &alpha, A, &lda, B, &ldb);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FINDBLAS_FORTRAN_H */
@@ -0,0 +1,103 @@
+/*	https://www.github.com/david-cortes/findblas
+	Level-1 BLAS (vector-vector): dot products, norms, axpy, copy/swap,
+	rotations, scaling.
+	Standalone - can be included on its own instead of the full "findblas.h"
+	to cut down on the declarations each translation unit has to parse; the
+	vendor-header dispatch lives in "findblas_common.h".
+	*/
+#ifndef FINDBLAS_LEVEL1_H
+#define FINDBLAS_LEVEL1_H
+
+#include "findblas_common.h"
+
+#ifdef FINDBLAS_OWN_PROTOTYPES
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+float  cblas_sdot(const findblas_int n, const float  *x, const findblas_int incx, const float  *y, const findblas_int incy);
+double cblas_ddot(const findblas_int n, const double *x, const findblas_int incx, const double *y, const findblas_int incy);
+
+#ifdef HAS_CBLAS_SDSDOT
+float  cblas_sdsdot(const findblas_int n, const float alpha, const float *x, const findblas_int incx, const float *y, const findblas_int incy);
+double cblas_dsdot (const findblas_int n, const float *x, const findblas_int incx, const float *y, const findblas_int incy);
+#else
+/*	composed fallbacks when the library lacks these entry points - note that
+	they accumulate in single precision, unlike the real routines */
+static inline float cblas_sdsdot(const findblas_int n, const float alpha, const float *x, const findblas_int incx, const float *y, const findblas_int incy)
+{
+    return alpha + cblas_sdot(n, x, incx, y, incy);
+}
+static inline double cblas_dsdot(const findblas_int n, const float *x, const findblas_int incx, const float *y, const findblas_int incy)
+{
+    return (double)cblas_sdot(n, x, incx, y, incy);
+}
+#endif
+
+openblas_complex_float  cblas_cdotu(const findblas_int n, const float  *x, const findblas_int incx, const float  *y, const findblas_int incy);
+openblas_complex_float  cblas_cdotc(const findblas_int n, const float  *x, const findblas_int incx, const float  *y, const findblas_int incy);
+openblas_complex_double cblas_zdotu(const findblas_int n, const double *x, const findblas_int incx, const double *y, const findblas_int incy);
+openblas_complex_double cblas_zdotc(const findblas_int n, const double *x, const findblas_int incx, const double *y, const findblas_int incy);
+
+void  cblas_cdotu_sub(const findblas_int n, const float  *x, const findblas_int incx, const float  *y, const findblas_int incy, openblas_complex_float  *ret);
+void  cblas_cdotc_sub(const findblas_int n, const float  *x, const findblas_int incx, const float  *y, const findblas_int incy, openblas_complex_float  *ret);
+void  cblas_zdotu_sub(const findblas_int n, const double *x, const findblas_int incx, const double *y, const findblas_int incy, openblas_complex_double *ret);
+void  cblas_zdotc_sub(const findblas_int n, const double *x, const findblas_int incx, const double *y, const findblas_int incy, openblas_complex_double *ret);
+
+float  cblas_sasum (const findblas_int n, const float  *x, const findblas_int incx);
+double cblas_dasum (const findblas_int n, const double *x, const findblas_int incx);
+float  cblas_scasum(const findblas_int n, const float  *x, const findblas_int incx);
+double cblas_dzasum(const findblas_int n, const double *x, const findblas_int incx);
+
+float  cblas_snrm2 (const findblas_int N, const float  *X, const findblas_int incX);
+double cblas_dnrm2 (const findblas_int N, const double *X, const findblas_int incX);
+float  cblas_scnrm2(const findblas_int N, const float  *X, const findblas_int incX);
+double cblas_dznrm2(const findblas_int N, const double *X, const findblas_int incX);
+
+CBLAS_INDEX cblas_isamax(const findblas_int n, const float  *x, const findblas_int incx);
+CBLAS_INDEX cblas_idamax(const findblas_int n, const double *x, const findblas_int incx);
+CBLAS_INDEX cblas_icamax(const findblas_int n, const float  *x, const findblas_int incx);
+CBLAS_INDEX cblas_izamax(const findblas_int n, const double *x, const findblas_int incx);
+
+void cblas_saxpy(const findblas_int n, const float alpha, const float *x, const findblas_int incx, float *y, const findblas_int incy);
+void cblas_daxpy(const findblas_int n, const double alpha, const double *x, const findblas_int incx, double *y, const findblas_int incy);
+void cblas_caxpy(const findblas_int n, const float *alpha, const float *x, const findblas_int incx, float *y, const findblas_int incy);
+void cblas_zaxpy(const findblas_int n, const double *alpha, const double *x, const findblas_int incx, double *y, const findblas_int incy);
+
+void cblas_scopy(const findblas_int n, const float *x, const findblas_int incx, float *y, const findblas_int incy);
+void cblas_dcopy(const findblas_int n, const double *x, const findblas_int incx, double *y, const findblas_int incy);
+void cblas_ccopy(const findblas_int n, const float *x, const findblas_int incx, float *y, const findblas_int incy);
+void cblas_zcopy(const findblas_int n, const double *x, const findblas_int incx, double *y, const findblas_int incy);
+
+void cblas_sswap(const findblas_int n, float *x, const findblas_int incx, float *y, const findblas_int incy);
+void cblas_dswap(const findblas_int n, double *x, const findblas_int incx, double *y, const findblas_int incy);
+void cblas_cswap(const findblas_int n, float *x, const findblas_int incx, float *y, const findblas_int incy);
+void cblas_zswap(const findblas_int n, double *x, const findblas_int incx, double *y, const findblas_int incy);
+
+void cblas_srot(const findblas_int N, float *X, const findblas_int incX, float *Y, const findblas_int incY, const float c, const float s);
+void cblas_drot(const findblas_int N, double *X, const findblas_int incX, double *Y, const findblas_int incY, const double c, const double  s);
+
+void cblas_srotg(float *a, float *b, float *c, float *s);
+void cblas_drotg(double *a, double *b, double *c, double *s);
+
+void cblas_srotm(const findblas_int N, float *X, const findblas_int incX, float *Y, const findblas_int incY, const float *P);
+void cblas_drotm(const findblas_int N, double *X, const findblas_int incX, double *Y, const findblas_int incY, const double *P);
+
+void cblas_srotmg(float *d1, float *d2, float *b1, const float b2, float *P);
+void cblas_drotmg(double *d1, double *d2, double *b1, const double b2, double *P);
+
+void cblas_sscal(const findblas_int N, const float alpha, float *X, const findblas_int incX);
+void cblas_dscal(const findblas_int N, const double alpha, double *X, const findblas_int incX);
+void cblas_cscal(const findblas_int N, const float *alpha, float *X, const findblas_int incX);
+void cblas_zscal(const findblas_int N, const double *alpha, double *X, const findblas_int incX);
+void cblas_csscal(const findblas_int N, const float alpha, float *X, const findblas_int incX);
+void cblas_zdscal(const findblas_int N, const double alpha, double *X, const findblas_int incX);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FINDBLAS_OWN_PROTOTYPES */
+
+#endif /* FINDBLAS_LEVEL1_H */
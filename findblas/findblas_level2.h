@@ -0,0 +1,152 @@
+/*	https://www.github.com/david-cortes/findblas
+	Level-2 BLAS (matrix-vector): gemv, ger, symmetric/hermitian/banded/
+	packed matrix-vector products, triangular solves.
+	Standalone - can be included on its own instead of the full "findblas.h"
+	to cut down on the declarations each translation unit has to parse; the
+	vendor-header dispatch lives in "findblas_common.h".
+	*/
+#ifndef FINDBLAS_LEVEL2_H
+#define FINDBLAS_LEVEL2_H
+
+#include "findblas_common.h"
+
+#ifdef FINDBLAS_OWN_PROTOTYPES
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void cblas_sgemv(const enum CBLAS_ORDER order,  const enum CBLAS_TRANSPOSE trans,  const findblas_int m, const findblas_int n,
+		 const float alpha, const float  *a, const findblas_int lda,  const float  *x, const findblas_int incx,  const float beta,  float  *y, const findblas_int incy);
+void cblas_dgemv(const enum CBLAS_ORDER order,  const enum CBLAS_TRANSPOSE trans,  const findblas_int m, const findblas_int n,
+		 const double alpha, const double  *a, const findblas_int lda,  const double  *x, const findblas_int incx,  const double beta,  double  *y, const findblas_int incy);
+void cblas_cgemv(const enum CBLAS_ORDER order,  const enum CBLAS_TRANSPOSE trans,  const findblas_int m, const findblas_int n,
+		 const float *alpha, const float  *a, const findblas_int lda,  const float  *x, const findblas_int incx,  const float *beta,  float  *y, const findblas_int incy);
+void cblas_zgemv(const enum CBLAS_ORDER order,  const enum CBLAS_TRANSPOSE trans,  const findblas_int m, const findblas_int n,
+		 const double *alpha, const double  *a, const findblas_int lda,  const double  *x, const findblas_int incx,  const double *beta,  double  *y, const findblas_int incy);
+
+void cblas_sger (const enum CBLAS_ORDER order, const findblas_int M, const findblas_int N, const float   alpha, const float  *X, const findblas_int incX, const float  *Y, const findblas_int incY, float  *A, const findblas_int lda);
+void cblas_dger (const enum CBLAS_ORDER order, const findblas_int M, const findblas_int N, const double  alpha, const double *X, const findblas_int incX, const double *Y, const findblas_int incY, double *A, const findblas_int lda);
+void cblas_cgeru(const enum CBLAS_ORDER order, const findblas_int M, const findblas_int N, const float  *alpha, const float  *X, const findblas_int incX, const float  *Y, const findblas_int incY, float  *A, const findblas_int lda);
+void cblas_cgerc(const enum CBLAS_ORDER order, const findblas_int M, const findblas_int N, const float  *alpha, const float  *X, const findblas_int incX, const float  *Y, const findblas_int incY, float  *A, const findblas_int lda);
+void cblas_zgeru(const enum CBLAS_ORDER order, const findblas_int M, const findblas_int N, const double *alpha, const double *X, const findblas_int incX, const double *Y, const findblas_int incY, double *A, const findblas_int lda);
+void cblas_zgerc(const enum CBLAS_ORDER order, const findblas_int M, const findblas_int N, const double *alpha, const double *X, const findblas_int incX, const double *Y, const findblas_int incY, double *A, const findblas_int lda);
+
+void cblas_strsv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const float *A, const findblas_int lda, float *X, const findblas_int incX);
+void cblas_dtrsv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const double *A, const findblas_int lda, double *X, const findblas_int incX);
+void cblas_ctrsv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const float *A, const findblas_int lda, float *X, const findblas_int incX);
+void cblas_ztrsv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const double *A, const findblas_int lda, double *X, const findblas_int incX);
+
+void cblas_strmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const float *A, const findblas_int lda, float *X, const findblas_int incX);
+void cblas_dtrmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const double *A, const findblas_int lda, double *X, const findblas_int incX);
+void cblas_ctrmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const float *A, const findblas_int lda, float *X, const findblas_int incX);
+void cblas_ztrmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag, const findblas_int N, const double *A, const findblas_int lda, double *X, const findblas_int incX);
+
+void cblas_ssyr(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const float alpha, const float *X, const findblas_int incX, float *A, const findblas_int lda);
+void cblas_dsyr(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const double alpha, const double *X, const findblas_int incX, double *A, const findblas_int lda);
+void cblas_cher(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const float alpha, const float *X, const findblas_int incX, float *A, const findblas_int lda);
+void cblas_zher(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const double alpha, const double *X, const findblas_int incX, double *A, const findblas_int lda);
+
+void cblas_ssyr2(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo,const findblas_int N, const float alpha, const float *X,
+                const findblas_int incX, const float *Y, const findblas_int incY, float *A, const findblas_int lda);
+void cblas_dsyr2(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const double alpha, const double *X,
+                const findblas_int incX, const double *Y, const findblas_int incY, double *A, const findblas_int lda);
+void cblas_cher2(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const float *alpha, const float *X, const findblas_int incX,
+                const float *Y, const findblas_int incY, float *A, const findblas_int lda);
+void cblas_zher2(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const double *alpha, const double *X, const findblas_int incX,
+                const double *Y, const findblas_int incY, double *A, const findblas_int lda);
+
+void cblas_sgbmv(const enum CBLAS_ORDER order, const enum CBLAS_TRANSPOSE TransA, const findblas_int M, const findblas_int N,
+                 const findblas_int KL, const findblas_int KU, const float alpha, const float *A, const findblas_int lda, const float *X, const findblas_int incX, const float beta, float *Y, const findblas_int incY);
+void cblas_dgbmv(const enum CBLAS_ORDER order, const enum CBLAS_TRANSPOSE TransA, const findblas_int M, const findblas_int N,
+                 const findblas_int KL, const findblas_int KU, const double alpha, const double *A, const findblas_int lda, const double *X, const findblas_int incX, const double beta, double *Y, const findblas_int incY);
+void cblas_cgbmv(const enum CBLAS_ORDER order, const enum CBLAS_TRANSPOSE TransA, const findblas_int M, const findblas_int N,
+                 const findblas_int KL, const findblas_int KU, const float *alpha, const float *A, const findblas_int lda, const float *X, const findblas_int incX, const float *beta, float *Y, const findblas_int incY);
+void cblas_zgbmv(const enum CBLAS_ORDER order, const enum CBLAS_TRANSPOSE TransA, const findblas_int M, const findblas_int N,
+                 const findblas_int KL, const findblas_int KU, const double *alpha, const double *A, const findblas_int lda, const double *X, const findblas_int incX, const double *beta, double *Y, const findblas_int incY);
+
+void cblas_ssbmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const findblas_int K, const float alpha, const float *A,
+                 const findblas_int lda, const float *X, const findblas_int incX, const float beta, float *Y, const findblas_int incY);
+void cblas_dsbmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const findblas_int K, const double alpha, const double *A,
+                 const findblas_int lda, const double *X, const findblas_int incX, const double beta, double *Y, const findblas_int incY);
+
+
+void cblas_stbmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag,
+                 const findblas_int N, const findblas_int K, const float *A, const findblas_int lda, float *X, const findblas_int incX);
+void cblas_dtbmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag,
+                 const findblas_int N, const findblas_int K, const double *A, const findblas_int lda, double *X, const findblas_int incX);
+void cblas_ctbmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag,
+                 const findblas_int N, const findblas_int K, const float *A, const findblas_int lda, float *X, const findblas_int incX);
+void cblas_ztbmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag,
+                 const findblas_int N, const findblas_int K, const double *A, const findblas_int lda, double *X, const findblas_int incX);
+
+void cblas_stbsv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag,
+                 const findblas_int N, const findblas_int K, const float *A, const findblas_int lda, float *X, const findblas_int incX);
+void cblas_dtbsv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag,
+                 const findblas_int N, const findblas_int K, const double *A, const findblas_int lda, double *X, const findblas_int incX);
+void cblas_ctbsv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag,
+                 const findblas_int N, const findblas_int K, const float *A, const findblas_int lda, float *X, const findblas_int incX);
+void cblas_ztbsv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag,
+                 const findblas_int N, const findblas_int K, const double *A, const findblas_int lda, double *X, const findblas_int incX);
+
+void cblas_stpmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag,
+                 const findblas_int N, const float *Ap, float *X, const findblas_int incX);
+void cblas_dtpmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag,
+                 const findblas_int N, const double *Ap, double *X, const findblas_int incX);
+void cblas_ctpmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag,
+                 const findblas_int N, const float *Ap, float *X, const findblas_int incX);
+void cblas_ztpmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag,
+                 const findblas_int N, const double *Ap, double *X, const findblas_int incX);
+
+void cblas_stpsv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag,
+                 const findblas_int N, const float *Ap, float *X, const findblas_int incX);
+void cblas_dtpsv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag,
+                 const findblas_int N, const double *Ap, double *X, const findblas_int incX);
+void cblas_ctpsv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag,
+                 const findblas_int N, const float *Ap, float *X, const findblas_int incX);
+void cblas_ztpsv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_DIAG Diag,
+                 const findblas_int N, const double *Ap, double *X, const findblas_int incX);
+
+void cblas_ssymv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const float alpha, const float *A,
+                 const findblas_int lda, const float *X, const findblas_int incX, const float beta, float *Y, const findblas_int incY);
+void cblas_dsymv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const double alpha, const double *A,
+                 const findblas_int lda, const double *X, const findblas_int incX, const double beta, double *Y, const findblas_int incY);
+void cblas_chemv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const float *alpha, const float *A,
+                 const findblas_int lda, const float *X, const findblas_int incX, const float *beta, float *Y, const findblas_int incY);
+void cblas_zhemv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const double *alpha, const double *A,
+                 const findblas_int lda, const double *X, const findblas_int incX, const double *beta, double *Y, const findblas_int incY);
+
+
+void cblas_sspmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const float alpha, const float *Ap,
+                 const float *X, const findblas_int incX, const float beta, float *Y, const findblas_int incY);
+void cblas_dspmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const double alpha, const double *Ap,
+                 const double *X, const findblas_int incX, const double beta, double *Y, const findblas_int incY);
+
+void cblas_sspr(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const float alpha, const float *X, const findblas_int incX, float *Ap);
+void cblas_dspr(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const double alpha, const double *X, const findblas_int incX, double *Ap);
+
+void cblas_chpr(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const float alpha, const float *X, const findblas_int incX, float *A);
+void cblas_zhpr(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const double alpha, const double *X,const findblas_int incX, double *A);
+
+void cblas_sspr2(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const float alpha, const float *X, const findblas_int incX, const float *Y, const findblas_int incY, float *A);
+void cblas_dspr2(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const double alpha, const double *X, const findblas_int incX, const double *Y, const findblas_int incY, double *A);
+void cblas_chpr2(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const float *alpha, const float *X, const findblas_int incX, const float *Y, const findblas_int incY, float *Ap);
+void cblas_zhpr2(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const double *alpha, const double *X, const findblas_int incX, const double *Y, const findblas_int incY, double *Ap);
+
+void cblas_chbmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const findblas_int K,
+		 const float *alpha, const float *A, const findblas_int lda, const float *X, const findblas_int incX, const float *beta, float *Y, const findblas_int incY);
+void cblas_zhbmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N, const findblas_int K,
+		 const double *alpha, const double *A, const findblas_int lda, const double *X, const findblas_int incX, const double *beta, double *Y, const findblas_int incY);
+
+void cblas_chpmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N,
+		 const float *alpha, const float *Ap, const float *X, const findblas_int incX, const float *beta, float *Y, const findblas_int incY);
+void cblas_zhpmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const findblas_int N,
+		 const double *alpha, const double *Ap, const double *X, const findblas_int incX, const double *beta, double *Y, const findblas_int incY);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FINDBLAS_OWN_PROTOTYPES */
+
+#endif /* FINDBLAS_LEVEL2_H */
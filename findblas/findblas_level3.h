@@ -0,0 +1,114 @@
+/*	https://www.github.com/david-cortes/findblas
+	Level-3 BLAS (matrix-matrix): gemm, symm/hemm, syrk/herk, syr2k/her2k,
+	trmm, trsm.
+	Standalone - can be included on its own instead of the full "findblas.h"
+	to cut down on the declarations each translation unit has to parse; the
+	vendor-header dispatch lives in "findblas_common.h".
+	*/
+#ifndef FINDBLAS_LEVEL3_H
+#define FINDBLAS_LEVEL3_H
+
+#include "findblas_common.h"
+
+#ifdef FINDBLAS_OWN_PROTOTYPES
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void cblas_sgemm(const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_TRANSPOSE TransB, const findblas_int M, const findblas_int N, const findblas_int K,
+		 const float alpha, const float *A, const findblas_int lda, const float *B, const findblas_int ldb, const float beta, float *C, const findblas_int ldc);
+void cblas_dgemm(const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_TRANSPOSE TransB, const findblas_int M, const findblas_int N, const findblas_int K,
+		 const double alpha, const double *A, const findblas_int lda, const double *B, const findblas_int ldb, const double beta, double *C, const findblas_int ldc);
+void cblas_cgemm(const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_TRANSPOSE TransB, const findblas_int M, const findblas_int N, const findblas_int K,
+		 const float *alpha, const float *A, const findblas_int lda, const float *B, const findblas_int ldb, const float *beta, float *C, const findblas_int ldc);
+void cblas_zgemm(const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_TRANSPOSE TransB, const findblas_int M, const findblas_int N, const findblas_int K,
+		 const double *alpha, const double *A, const findblas_int lda, const double *B, const findblas_int ldb, const double *beta, double *C, const findblas_int ldc);
+
+#ifdef HAS_CBLAS_GEMM3M
+void cblas_cgemm3m(const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_TRANSPOSE TransB, const findblas_int M, const findblas_int N, const findblas_int K,
+		 const float *alpha, const float *A, const findblas_int lda, const float *B, const findblas_int ldb, const float *beta, float *C, const findblas_int ldc);
+void cblas_zgemm3m(const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_TRANSPOSE TransB, const findblas_int M, const findblas_int N, const findblas_int K,
+		 const double *alpha, const double *A, const findblas_int lda, const double *B, const findblas_int ldb, const double *beta, double *C, const findblas_int ldc);
+#else
+/*	composed fallbacks when the library lacks the 3m algorithm - just plain gemm */
+static inline void cblas_cgemm3m(const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_TRANSPOSE TransB, const findblas_int M, const findblas_int N, const findblas_int K,
+		 const float *alpha, const float *A, const findblas_int lda, const float *B, const findblas_int ldb, const float *beta, float *C, const findblas_int ldc)
+{
+    cblas_cgemm(Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+static inline void cblas_zgemm3m(const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_TRANSPOSE TransB, const findblas_int M, const findblas_int N, const findblas_int K,
+		 const double *alpha, const double *A, const findblas_int lda, const double *B, const findblas_int ldb, const double *beta, double *C, const findblas_int ldc)
+{
+    cblas_zgemm(Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+#endif
+
+
+void cblas_ssymm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const findblas_int M, const findblas_int N,
+                 const float alpha, const float *A, const findblas_int lda, const float *B, const findblas_int ldb, const float beta, float *C, const findblas_int ldc);
+void cblas_dsymm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const findblas_int M, const findblas_int N,
+                 const double alpha, const double *A, const findblas_int lda, const double *B, const findblas_int ldb, const double beta, double *C, const findblas_int ldc);
+void cblas_csymm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const findblas_int M, const findblas_int N,
+                 const float *alpha, const float *A, const findblas_int lda, const float *B, const findblas_int ldb, const float *beta, float *C, const findblas_int ldc);
+void cblas_zsymm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const findblas_int M, const findblas_int N,
+                 const double *alpha, const double *A, const findblas_int lda, const double *B, const findblas_int ldb, const double *beta, double *C, const findblas_int ldc);
+
+void cblas_ssyrk(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans,
+		 const findblas_int N, const findblas_int K, const float alpha, const float *A, const findblas_int lda, const float beta, float *C, const findblas_int ldc);
+void cblas_dsyrk(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans,
+		 const findblas_int N, const findblas_int K, const double alpha, const double *A, const findblas_int lda, const double beta, double *C, const findblas_int ldc);
+void cblas_csyrk(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans,
+		 const findblas_int N, const findblas_int K, const float *alpha, const float *A, const findblas_int lda, const float *beta, float *C, const findblas_int ldc);
+void cblas_zsyrk(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans,
+		 const findblas_int N, const findblas_int K, const double *alpha, const double *A, const findblas_int lda, const double *beta, double *C, const findblas_int ldc);
+
+void cblas_ssyr2k(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans,
+		  const findblas_int N, const findblas_int K, const float alpha, const float *A, const findblas_int lda, const float *B, const findblas_int ldb, const float beta, float *C, const findblas_int ldc);
+void cblas_dsyr2k(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans,
+		  const findblas_int N, const findblas_int K, const double alpha, const double *A, const findblas_int lda, const double *B, const findblas_int ldb, const double beta, double *C, const findblas_int ldc);
+void cblas_csyr2k(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans,
+		  const findblas_int N, const findblas_int K, const float *alpha, const float *A, const findblas_int lda, const float *B, const findblas_int ldb, const float *beta, float *C, const findblas_int ldc);
+void cblas_zsyr2k(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans,
+		  const findblas_int N, const findblas_int K, const double *alpha, const double *A, const findblas_int lda, const double *B, const findblas_int ldb, const double *beta, double *C, const findblas_int ldc);
+
+void cblas_strmm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA,
+                 const enum CBLAS_DIAG Diag, const findblas_int M, const findblas_int N, const float alpha, const float *A, const findblas_int lda, float *B, const findblas_int ldb);
+void cblas_dtrmm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA,
+                 const enum CBLAS_DIAG Diag, const findblas_int M, const findblas_int N, const double alpha, const double *A, const findblas_int lda, double *B, const findblas_int ldb);
+void cblas_ctrmm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA,
+                 const enum CBLAS_DIAG Diag, const findblas_int M, const findblas_int N, const float *alpha, const float *A, const findblas_int lda, float *B, const findblas_int ldb);
+void cblas_ztrmm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA,
+                 const enum CBLAS_DIAG Diag, const findblas_int M, const findblas_int N, const double *alpha, const double *A, const findblas_int lda, double *B, const findblas_int ldb);
+
+void cblas_strsm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA,
+                 const enum CBLAS_DIAG Diag, const findblas_int M, const findblas_int N, const float alpha, const float *A, const findblas_int lda, float *B, const findblas_int ldb);
+void cblas_dtrsm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA,
+                 const enum CBLAS_DIAG Diag, const findblas_int M, const findblas_int N, const double alpha, const double *A, const findblas_int lda, double *B, const findblas_int ldb);
+void cblas_ctrsm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA,
+                 const enum CBLAS_DIAG Diag, const findblas_int M, const findblas_int N, const float *alpha, const float *A, const findblas_int lda, float *B, const findblas_int ldb);
+void cblas_ztrsm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA,
+                 const enum CBLAS_DIAG Diag, const findblas_int M, const findblas_int N, const double *alpha, const double *A, const findblas_int lda, double *B, const findblas_int ldb);
+
+void cblas_chemm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const findblas_int M, const findblas_int N,
+                 const float *alpha, const float *A, const findblas_int lda, const float *B, const findblas_int ldb, const float *beta, float *C, const findblas_int ldc);
+void cblas_zhemm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo, const findblas_int M, const findblas_int N,
+                 const double *alpha, const double *A, const findblas_int lda, const double *B, const findblas_int ldb, const double *beta, double *C, const findblas_int ldc);
+
+void cblas_cherk(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans, const findblas_int N, const findblas_int K,
+                 const float alpha, const float *A, const findblas_int lda, const float beta, float *C, const findblas_int ldc);
+void cblas_zherk(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans, const findblas_int N, const findblas_int K,
+                 const double alpha, const double *A, const findblas_int lda, const double beta, double *C, const findblas_int ldc);
+
+void cblas_cher2k(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans, const findblas_int N, const findblas_int K,
+                  const float *alpha, const float *A, const findblas_int lda, const float *B, const findblas_int ldb, const float beta, float *C, const findblas_int ldc);
+void cblas_zher2k(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans, const findblas_int N, const findblas_int K,
+                  const double *alpha, const double *A, const findblas_int lda, const double *B, const findblas_int ldb, const double beta, double *C, const findblas_int ldc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FINDBLAS_OWN_PROTOTYPES */
+
+#endif /* FINDBLAS_LEVEL3_H */
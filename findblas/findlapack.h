@@ -0,0 +1,105 @@
+/*	https://www.github.com/david-cortes/findblas
+	Companion to "findblas.h" for LAPACK - intended to be used along with
+	'find_lapack()' and the 'build_ext_with_blas' class (with environment
+	variable 'FINDBLAS_LINK_LAPACK' set). Will include the correct LAPACK(E)
+	header for the vendor version when one was found, and otherwise declares
+	prototypes for the core factorization routines here, which might be
+	unreliable.
+	*/
+
+/*	If 'build_ext_with_blas' wrote its flags into a generated
+	"findblas_config.h", pick that file up here too (see "findblas.h") */
+#if defined(__has_include) && !defined(FINDBLAS_NO_CONFIG_HEADER)
+#  if __has_include("findblas_config.h")
+#    include "findblas_config.h"
+#  endif
+#endif
+
+/*	Integer type for indices and dimensions - see the note in "findblas.h" */
+#ifndef FINDBLAS_INT_DEFINED
+#define FINDBLAS_INT_DEFINED
+#if defined(BLAS_ILP64) || defined(LAPACK_ILP64) || defined(FINDBLAS_ILP64)
+typedef long long findblas_int;
+#else
+typedef int findblas_int;
+#endif
+#endif
+
+#if defined MKL_OWN_INCL_LAPACKE
+  #include "mkl_lapacke.h"
+#elif defined(HAS_MKL) && !defined(NO_LAPACKE_HEADER)
+  #include "mkl.h"
+#elif defined INCL_LAPACKE
+  #include "lapacke.h"
+#else
+
+/*	No vendor header found - declare the core factorization and eigenvalue
+	routines through their Fortran symbols (names ending in underscores,
+	which is how OpenBLAS, ATLAS, libflame and reference LAPACK export them).
+	*/
+#ifndef FINDLAPACK_H
+#define FINDLAPACK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Cholesky */
+void spotrf_(const char *uplo, const findblas_int *n, float  *a, const findblas_int *lda, findblas_int *info);
+void dpotrf_(const char *uplo, const findblas_int *n, double *a, const findblas_int *lda, findblas_int *info);
+void spotrs_(const char *uplo, const findblas_int *n, const findblas_int *nrhs, const float  *a, const findblas_int *lda,
+             float  *b, const findblas_int *ldb, findblas_int *info);
+void dpotrs_(const char *uplo, const findblas_int *n, const findblas_int *nrhs, const double *a, const findblas_int *lda,
+             double *b, const findblas_int *ldb, findblas_int *info);
+
+/* LU */
+void sgetrf_(const findblas_int *m, const findblas_int *n, float  *a, const findblas_int *lda, findblas_int *ipiv, findblas_int *info);
+void dgetrf_(const findblas_int *m, const findblas_int *n, double *a, const findblas_int *lda, findblas_int *ipiv, findblas_int *info);
+void sgetrs_(const char *trans, const findblas_int *n, const findblas_int *nrhs, const float  *a, const findblas_int *lda,
+             const findblas_int *ipiv, float  *b, const findblas_int *ldb, findblas_int *info);
+void dgetrs_(const char *trans, const findblas_int *n, const findblas_int *nrhs, const double *a, const findblas_int *lda,
+             const findblas_int *ipiv, double *b, const findblas_int *ldb, findblas_int *info);
+void sgetri_(const findblas_int *n, float  *a, const findblas_int *lda, const findblas_int *ipiv,
+             float  *work, const findblas_int *lwork, findblas_int *info);
+void dgetri_(const findblas_int *n, double *a, const findblas_int *lda, const findblas_int *ipiv,
+             double *work, const findblas_int *lwork, findblas_int *info);
+void sgesv_ (const findblas_int *n, const findblas_int *nrhs, float  *a, const findblas_int *lda, findblas_int *ipiv,
+             float  *b, const findblas_int *ldb, findblas_int *info);
+void dgesv_ (const findblas_int *n, const findblas_int *nrhs, double *a, const findblas_int *lda, findblas_int *ipiv,
+             double *b, const findblas_int *ldb, findblas_int *info);
+
+/* symmetric eigenvalues */
+void ssyevr_(const char *jobz, const char *range, const char *uplo, const findblas_int *n, float  *a, const findblas_int *lda,
+             const float  *vl, const float  *vu, const findblas_int *il, const findblas_int *iu, const float  *abstol,
+             findblas_int *m, float  *w, float  *z, const findblas_int *ldz, findblas_int *isuppz,
+             float  *work, const findblas_int *lwork, findblas_int *iwork, const findblas_int *liwork, findblas_int *info);
+void dsyevr_(const char *jobz, const char *range, const char *uplo, const findblas_int *n, double *a, const findblas_int *lda,
+             const double *vl, const double *vu, const findblas_int *il, const findblas_int *iu, const double *abstol,
+             findblas_int *m, double *w, double *z, const findblas_int *ldz, findblas_int *isuppz,
+             double *work, const findblas_int *lwork, findblas_int *iwork, const findblas_int *liwork, findblas_int *info);
+void ssyevd_(const char *jobz, const char *uplo, const findblas_int *n, float  *a, const findblas_int *lda, float  *w,
+             float  *work, const findblas_int *lwork, findblas_int *iwork, const findblas_int *liwork, findblas_int *info);
+void dsyevd_(const char *jobz, const char *uplo, const findblas_int *n, double *a, const findblas_int *lda, double *w,
+             double *work, const findblas_int *lwork, findblas_int *iwork, const findblas_int *liwork, findblas_int *info);
+
+/* SVD and least squares */
+void sgesdd_(const char *jobz, const findblas_int *m, const findblas_int *n, float  *a, const findblas_int *lda,
+             float  *s, float  *u, const findblas_int *ldu, float  *vt, const findblas_int *ldvt,
+             float  *work, const findblas_int *lwork, findblas_int *iwork, findblas_int *info);
+void dgesdd_(const char *jobz, const findblas_int *m, const findblas_int *n, double *a, const findblas_int *lda,
+             double *s, double *u, const findblas_int *ldu, double *vt, const findblas_int *ldvt,
+             double *work, const findblas_int *lwork, findblas_int *iwork, findblas_int *info);
+void sgels_ (const char *trans, const findblas_int *m, const findblas_int *n, const findblas_int *nrhs,
+             float  *a, const findblas_int *lda, float  *b, const findblas_int *ldb,
+             float  *work, const findblas_int *lwork, findblas_int *info);
+void dgels_ (const char *trans, const findblas_int *m, const findblas_int *n, const findblas_int *nrhs,
+             double *a, const findblas_int *lda, double *b, const findblas_int *ldb,
+             double *work, const findblas_int *lwork, findblas_int *info);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FINDLAPACK_H */
+
+#endif
@@ -1,7 +1,14 @@
 /*
-  The functions here are solely for code C to compile in ReadTheDocs
-  without having any specific BLAS library as dependency. They do
-  not do anything.
+  Compiled in place of a real BLAS when none is available: either for C code
+  to compile in ReadTheDocs without having any specific BLAS library as a
+  dependency, or as a last-resort fallback engine in BLAS-less environments
+  such as hermetic build sandboxes and minimal containers - see environment
+  variable 'FINDBLAS_FALLBACK' in 'build_ext_with_blas'.
+
+  The level-1 routines plus '?gemv'/'?ger'/'?gemm'/'?syrk' (real precisions)
+  are implemented here for real - plain autovectorizable C, roughly
+  reference-BLAS quality - so correctness suites can run at tolerable speed
+  without a vendor library. The remaining routines are still no-op stubs.
 	*/
 
 
@@ -57,10 +64,72 @@ typedef enum CBLAS_SIDE      {CblasLeft=141, CblasRight=142} CBLAS_SIDE;
   #define openblas_complex_double_imag(z)            ((z).imag)
 #endif /* OPENBLAS_CONFIG_H */
 
-float  cblas_sdsdot(const int n, const float alpha, const float *x, const int incx, const float *y, const int incy) {return 0;}
-double cblas_dsdot (const int n, const float *x, const int incx, const float *y, const int incy) {return 0;}
-float  cblas_sdot(const int n, const float  *x, const int incx, const float  *y, const int incy) {return 0;}
-double cblas_ddot(const int n, const double *x, const int incx, const double *y, const int incy) {return 0;}
+#include <math.h>
+
+#ifdef __cplusplus
+#define FINDBLAS_MOCK_RESTRICT __restrict
+#else
+#define FINDBLAS_MOCK_RESTRICT restrict
+#endif
+
+/*	tile size for the blocked level-3 loops (elements, not bytes) */
+#define FINDBLAS_MOCK_TILE 64
+
+/*	starting index for a strided vector walk (negative increments walk the
+	vector backwards, per the BLAS convention) */
+static int findblas_mock_start(const int n, const int inc)
+{
+    return (inc < 0)? (n - 1) * (-inc) : 0;
+}
+
+double cblas_dsdot (const int n, const float *x, const int incx, const float *y, const int incy)
+{
+    double res = 0.;
+    int ix = findblas_mock_start(n, incx);
+    int iy = findblas_mock_start(n, incy);
+    int i;
+    for (i = 0; i < n; i++, ix += incx, iy += incy)
+        res += (double)x[ix] * (double)y[iy];
+    return res;
+}
+float  cblas_sdsdot(const int n, const float alpha, const float *x, const int incx, const float *y, const int incy)
+{
+    return alpha + (float)cblas_dsdot(n, x, incx, y, incy);
+}
+float  cblas_sdot(const int n, const float  *x, const int incx, const float  *y, const int incy)
+{
+    float res = 0;
+    int i;
+    if (incx == 1 && incy == 1) {
+        const float *FINDBLAS_MOCK_RESTRICT xx = x;
+        const float *FINDBLAS_MOCK_RESTRICT yy = y;
+        for (i = 0; i < n; i++)
+            res += xx[i] * yy[i];
+    } else {
+        int ix = findblas_mock_start(n, incx);
+        int iy = findblas_mock_start(n, incy);
+        for (i = 0; i < n; i++, ix += incx, iy += incy)
+            res += x[ix] * y[iy];
+    }
+    return res;
+}
+double cblas_ddot(const int n, const double *x, const int incx, const double *y, const int incy)
+{
+    double res = 0;
+    int i;
+    if (incx == 1 && incy == 1) {
+        const double *FINDBLAS_MOCK_RESTRICT xx = x;
+        const double *FINDBLAS_MOCK_RESTRICT yy = y;
+        for (i = 0; i < n; i++)
+            res += xx[i] * yy[i];
+    } else {
+        int ix = findblas_mock_start(n, incx);
+        int iy = findblas_mock_start(n, incy);
+        for (i = 0; i < n; i++, ix += incx, iy += incy)
+            res += x[ix] * y[iy];
+    }
+    return res;
+}
 
 openblas_complex_float  cblas_cdotu(const int n, const float  *x, const int incx, const float  *y, const int incy) {return openblas_make_complex_float(0,0);}
 openblas_complex_float  cblas_cdotc(const int n, const float  *x, const int incx, const float  *y, const int incy) {return openblas_make_complex_float(0,0);}
@@ -72,66 +141,630 @@ void  cblas_cdotc_sub(const int n, const float  *x, const int incx, const float
 void  cblas_zdotu_sub(const int n, const double *x, const int incx, const double *y, const int incy, openblas_complex_double *ret) {return;}
 void  cblas_zdotc_sub(const int n, const double *x, const int incx, const double *y, const int incy, openblas_complex_double *ret) {return;}
 
-float  cblas_sasum (const int n, const float  *x, const int incx) {return 0;}
-double cblas_dasum (const int n, const double *x, const int incx) {return 0;}
+float  cblas_sasum (const int n, const float  *x, const int incx)
+{
+    float res = 0;
+    int ix = findblas_mock_start(n, incx);
+    int i;
+    for (i = 0; i < n; i++, ix += incx)
+        res += fabsf(x[ix]);
+    return res;
+}
+double cblas_dasum (const int n, const double *x, const int incx)
+{
+    double res = 0;
+    int ix = findblas_mock_start(n, incx);
+    int i;
+    for (i = 0; i < n; i++, ix += incx)
+        res += fabs(x[ix]);
+    return res;
+}
 float  cblas_scasum(const int n, const float  *x, const int incx) {return 0;}
 double cblas_dzasum(const int n, const double *x, const int incx) {return 0;}
 
-float  cblas_snrm2 (const int N, const float  *X, const int incX) {return 0;}
-double cblas_dnrm2 (const int N, const double *X, const int incX) {return 0;}
+float  cblas_snrm2 (const int N, const float  *X, const int incX)
+{
+    float scale = 0, ssq = 1, ax;
+    int ix = findblas_mock_start(N, incX);
+    int i;
+    for (i = 0; i < N; i++, ix += incX) {
+        if (X[ix] == 0)
+            continue;
+        ax = fabsf(X[ix]);
+        if (scale < ax) {
+            ssq = 1 + ssq * (scale / ax) * (scale / ax);
+            scale = ax;
+        } else {
+            ssq += (ax / scale) * (ax / scale);
+        }
+    }
+    return scale * sqrtf(ssq);
+}
+double cblas_dnrm2 (const int N, const double *X, const int incX)
+{
+    double scale = 0, ssq = 1, ax;
+    int ix = findblas_mock_start(N, incX);
+    int i;
+    for (i = 0; i < N; i++, ix += incX) {
+        if (X[ix] == 0)
+            continue;
+        ax = fabs(X[ix]);
+        if (scale < ax) {
+            ssq = 1 + ssq * (scale / ax) * (scale / ax);
+            scale = ax;
+        } else {
+            ssq += (ax / scale) * (ax / scale);
+        }
+    }
+    return scale * sqrt(ssq);
+}
 float  cblas_scnrm2(const int N, const float  *X, const int incX) {return 0;}
 double cblas_dznrm2(const int N, const double *X, const int incX) {return 0;}
 
-CBLAS_INDEX cblas_isamax(const int n, const float  *x, const int incx) {return 0;}
-CBLAS_INDEX cblas_idamax(const int n, const double *x, const int incx) {return 0;}
+CBLAS_INDEX cblas_isamax(const int n, const float  *x, const int incx)
+{
+    CBLAS_INDEX res = 0;
+    float best;
+    int ix, i;
+    if (n < 1 || incx <= 0)
+        return 0;
+    best = fabsf(x[0]);
+    for (i = 1, ix = incx; i < n; i++, ix += incx) {
+        if (fabsf(x[ix]) > best) {
+            best = fabsf(x[ix]);
+            res = (CBLAS_INDEX)i;
+        }
+    }
+    return res;
+}
+CBLAS_INDEX cblas_idamax(const int n, const double *x, const int incx)
+{
+    CBLAS_INDEX res = 0;
+    double best;
+    int ix, i;
+    if (n < 1 || incx <= 0)
+        return 0;
+    best = fabs(x[0]);
+    for (i = 1, ix = incx; i < n; i++, ix += incx) {
+        if (fabs(x[ix]) > best) {
+            best = fabs(x[ix]);
+            res = (CBLAS_INDEX)i;
+        }
+    }
+    return res;
+}
 CBLAS_INDEX cblas_icamax(const int n, const float  *x, const int incx) {return 0;}
 CBLAS_INDEX cblas_izamax(const int n, const double *x, const int incx) {return 0;}
 
-void cblas_saxpy(const int n, const float alpha, const float *x, const int incx, float *y, const int incy) {return;}
-void cblas_daxpy(const int n, const double alpha, const double *x, const int incx, double *y, const int incy) {return;}
+void cblas_saxpy(const int n, const float alpha, const float *x, const int incx, float *y, const int incy)
+{
+    int i;
+    if (incx == 1 && incy == 1) {
+        const float *FINDBLAS_MOCK_RESTRICT xx = x;
+        float *FINDBLAS_MOCK_RESTRICT yy = y;
+        for (i = 0; i < n; i++)
+            yy[i] += alpha * xx[i];
+    } else {
+        int ix = findblas_mock_start(n, incx);
+        int iy = findblas_mock_start(n, incy);
+        for (i = 0; i < n; i++, ix += incx, iy += incy)
+            y[iy] += alpha * x[ix];
+    }
+}
+void cblas_daxpy(const int n, const double alpha, const double *x, const int incx, double *y, const int incy)
+{
+    int i;
+    if (incx == 1 && incy == 1) {
+        const double *FINDBLAS_MOCK_RESTRICT xx = x;
+        double *FINDBLAS_MOCK_RESTRICT yy = y;
+        for (i = 0; i < n; i++)
+            yy[i] += alpha * xx[i];
+    } else {
+        int ix = findblas_mock_start(n, incx);
+        int iy = findblas_mock_start(n, incy);
+        for (i = 0; i < n; i++, ix += incx, iy += incy)
+            y[iy] += alpha * x[ix];
+    }
+}
 void cblas_caxpy(const int n, const float *alpha, const float *x, const int incx, float *y, const int incy) {return;}
 void cblas_zaxpy(const int n, const double *alpha, const double *x, const int incx, double *y, const int incy) {return;}
 
-void cblas_scopy(const int n, const float *x, const int incx, float *y, const int incy) {return;}
-void cblas_dcopy(const int n, const double *x, const int incx, double *y, const int incy) {return;}
+void cblas_scopy(const int n, const float *x, const int incx, float *y, const int incy)
+{
+    int ix = findblas_mock_start(n, incx);
+    int iy = findblas_mock_start(n, incy);
+    int i;
+    for (i = 0; i < n; i++, ix += incx, iy += incy)
+        y[iy] = x[ix];
+}
+void cblas_dcopy(const int n, const double *x, const int incx, double *y, const int incy)
+{
+    int ix = findblas_mock_start(n, incx);
+    int iy = findblas_mock_start(n, incy);
+    int i;
+    for (i = 0; i < n; i++, ix += incx, iy += incy)
+        y[iy] = x[ix];
+}
 void cblas_ccopy(const int n, const float *x, const int incx, float *y, const int incy) {return;}
 void cblas_zcopy(const int n, const double *x, const int incx, double *y, const int incy) {return;}
 
-void cblas_sswap(const int n, float *x, const int incx, float *y, const int incy) {return;}
-void cblas_dswap(const int n, double *x, const int incx, double *y, const int incy) {return;}
+void cblas_sswap(const int n, float *x, const int incx, float *y, const int incy)
+{
+    float temp;
+    int ix = findblas_mock_start(n, incx);
+    int iy = findblas_mock_start(n, incy);
+    int i;
+    for (i = 0; i < n; i++, ix += incx, iy += incy) {
+        temp = x[ix];
+        x[ix] = y[iy];
+        y[iy] = temp;
+    }
+}
+void cblas_dswap(const int n, double *x, const int incx, double *y, const int incy)
+{
+    double temp;
+    int ix = findblas_mock_start(n, incx);
+    int iy = findblas_mock_start(n, incy);
+    int i;
+    for (i = 0; i < n; i++, ix += incx, iy += incy) {
+        temp = x[ix];
+        x[ix] = y[iy];
+        y[iy] = temp;
+    }
+}
 void cblas_cswap(const int n, float *x, const int incx, float *y, const int incy) {return;}
 void cblas_zswap(const int n, double *x, const int incx, double *y, const int incy) {return;}
 
-void cblas_srot(const int N, float *X, const int incX, float *Y, const int incY, const float c, const float s) {return;}
-void cblas_drot(const int N, double *X, const int incX, double *Y, const int incY, const double c, const double  s) {return;}
+void cblas_srot(const int N, float *X, const int incX, float *Y, const int incY, const float c, const float s)
+{
+    float temp;
+    int ix = findblas_mock_start(N, incX);
+    int iy = findblas_mock_start(N, incY);
+    int i;
+    for (i = 0; i < N; i++, ix += incX, iy += incY) {
+        temp = c * X[ix] + s * Y[iy];
+        Y[iy] = c * Y[iy] - s * X[ix];
+        X[ix] = temp;
+    }
+}
+void cblas_drot(const int N, double *X, const int incX, double *Y, const int incY, const double c, const double  s)
+{
+    double temp;
+    int ix = findblas_mock_start(N, incX);
+    int iy = findblas_mock_start(N, incY);
+    int i;
+    for (i = 0; i < N; i++, ix += incX, iy += incY) {
+        temp = c * X[ix] + s * Y[iy];
+        Y[iy] = c * Y[iy] - s * X[ix];
+        X[ix] = temp;
+    }
+}
 
-void cblas_srotg(float *a, float *b, float *c, float *s) {return;}
-void cblas_drotg(double *a, double *b, double *c, double *s) {return;}
+void cblas_srotg(float *a, float *b, float *c, float *s)
+{
+    float r, z, roe, scale;
+    roe = (fabsf(*a) > fabsf(*b))? *a : *b;
+    scale = fabsf(*a) + fabsf(*b);
+    if (scale == 0) {
+        *c = 1;
+        *s = 0;
+        r = 0;
+        z = 0;
+    } else {
+        r = scale * sqrtf((*a / scale) * (*a / scale) + (*b / scale) * (*b / scale));
+        r = (roe < 0)? -r : r;
+        *c = *a / r;
+        *s = *b / r;
+        z = 1;
+        if (fabsf(*a) > fabsf(*b))
+            z = *s;
+        else if (*c != 0)
+            z = 1 / *c;
+    }
+    *a = r;
+    *b = z;
+}
+void cblas_drotg(double *a, double *b, double *c, double *s)
+{
+    double r, z, roe, scale;
+    roe = (fabs(*a) > fabs(*b))? *a : *b;
+    scale = fabs(*a) + fabs(*b);
+    if (scale == 0) {
+        *c = 1;
+        *s = 0;
+        r = 0;
+        z = 0;
+    } else {
+        r = scale * sqrt((*a / scale) * (*a / scale) + (*b / scale) * (*b / scale));
+        r = (roe < 0)? -r : r;
+        *c = *a / r;
+        *s = *b / r;
+        z = 1;
+        if (fabs(*a) > fabs(*b))
+            z = *s;
+        else if (*c != 0)
+            z = 1 / *c;
+    }
+    *a = r;
+    *b = z;
+}
 
-void cblas_srotm(const int N, float *X, const int incX, float *Y, const int incY, const float *P) {return;}
-void cblas_drotm(const int N, double *X, const int incX, double *Y, const int incY, const double *P) {return;}
+void cblas_srotm(const int N, float *X, const int incX, float *Y, const int incY, const float *P)
+{
+    const float flag = P[0];
+    float h11, h12, h21, h22, w, z;
+    int ix = findblas_mock_start(N, incX);
+    int iy = findblas_mock_start(N, incY);
+    int i;
+    if (flag == -2)
+        return;
+    if (flag == -1) {
+        h11 = P[1]; h21 = P[2]; h12 = P[3]; h22 = P[4];
+    } else if (flag == 0) {
+        h11 = 1; h21 = P[2]; h12 = P[3]; h22 = 1;
+    } else {
+        h11 = P[1]; h21 = -1; h12 = 1; h22 = P[4];
+    }
+    for (i = 0; i < N; i++, ix += incX, iy += incY) {
+        w = X[ix];
+        z = Y[iy];
+        X[ix] = h11 * w + h12 * z;
+        Y[iy] = h21 * w + h22 * z;
+    }
+}
+void cblas_drotm(const int N, double *X, const int incX, double *Y, const int incY, const double *P)
+{
+    const double flag = P[0];
+    double h11, h12, h21, h22, w, z;
+    int ix = findblas_mock_start(N, incX);
+    int iy = findblas_mock_start(N, incY);
+    int i;
+    if (flag == -2)
+        return;
+    if (flag == -1) {
+        h11 = P[1]; h21 = P[2]; h12 = P[3]; h22 = P[4];
+    } else if (flag == 0) {
+        h11 = 1; h21 = P[2]; h12 = P[3]; h22 = 1;
+    } else {
+        h11 = P[1]; h21 = -1; h12 = 1; h22 = P[4];
+    }
+    for (i = 0; i < N; i++, ix += incX, iy += incY) {
+        w = X[ix];
+        z = Y[iy];
+        X[ix] = h11 * w + h12 * z;
+        Y[iy] = h21 * w + h22 * z;
+    }
+}
 
-void cblas_srotmg(float *d1, float *d2, float *b1, const float b2, float *P) {return;}
-void cblas_drotmg(double *d1, double *d2, double *b1, const double b2, double *P) {return;}
+void cblas_srotmg(float *d1, float *d2, float *b1, const float b2, float *P)
+{
+    const float gam = 4096, gamsq = 4096 * (float)4096, rgamsq = 1 / (4096 * (float)4096);
+    float flag, h11 = 0, h12 = 0, h21 = 0, h22 = 0, p1, p2, q1, q2, u, temp;
+    if (*d1 < 0) {
+        flag = -1;
+        *d1 = 0;
+        *d2 = 0;
+        *b1 = 0;
+    } else {
+        p2 = *d2 * b2;
+        if (p2 == 0) {
+            P[0] = -2;
+            return;
+        }
+        p1 = *d1 * *b1;
+        q2 = p2 * b2;
+        q1 = p1 * *b1;
+        if (fabsf(q1) > fabsf(q2)) {
+            h21 = -b2 / *b1;
+            h12 = p2 / p1;
+            u = 1 - h12 * h21;
+            if (u > 0) {
+                flag = 0;
+                *d1 /= u;
+                *d2 /= u;
+                *b1 *= u;
+            } else {
+                flag = -1;
+                h11 = 0; h12 = 0; h21 = 0; h22 = 0;
+                *d1 = 0;
+                *d2 = 0;
+                *b1 = 0;
+            }
+        } else if (q2 < 0) {
+            flag = -1;
+            h11 = 0; h12 = 0; h21 = 0; h22 = 0;
+            *d1 = 0;
+            *d2 = 0;
+            *b1 = 0;
+        } else {
+            flag = 1;
+            h11 = p1 / p2;
+            h22 = *b1 / b2;
+            u = 1 + h11 * h22;
+            temp = *d2 / u;
+            *d2 = *d1 / u;
+            *d1 = temp;
+            *b1 = b2 * u;
+        }
+        if (*d1 != 0) {
+            while (*d1 <= rgamsq || *d1 >= gamsq) {
+                if (flag == 0) {
+                    h11 = 1;
+                    h22 = 1;
+                } else if (flag > 0) {
+                    h21 = -1;
+                    h12 = 1;
+                }
+                flag = -1;
+                if (*d1 <= rgamsq) {
+                    *d1 *= gamsq;
+                    *b1 /= gam;
+                    h11 /= gam;
+                    h12 /= gam;
+                } else {
+                    *d1 /= gamsq;
+                    *b1 *= gam;
+                    h11 *= gam;
+                    h12 *= gam;
+                }
+            }
+        }
+        if (*d2 != 0) {
+            while (fabsf(*d2) <= rgamsq || fabsf(*d2) >= gamsq) {
+                if (flag == 0) {
+                    h11 = 1;
+                    h22 = 1;
+                } else if (flag > 0) {
+                    h21 = -1;
+                    h12 = 1;
+                }
+                flag = -1;
+                if (fabsf(*d2) <= rgamsq) {
+                    *d2 *= gamsq;
+                    h21 /= gam;
+                    h22 /= gam;
+                } else {
+                    *d2 /= gamsq;
+                    h21 *= gam;
+                    h22 *= gam;
+                }
+            }
+        }
+    }
+    P[0] = flag;
+    if (flag < 0) {
+        P[1] = h11; P[2] = h21; P[3] = h12; P[4] = h22;
+    } else if (flag == 0) {
+        P[2] = h21; P[3] = h12;
+    } else {
+        P[1] = h11; P[4] = h22;
+    }
+}
+void cblas_drotmg(double *d1, double *d2, double *b1, const double b2, double *P)
+{
+    const double gam = 4096, gamsq = 4096 * (double)4096, rgamsq = 1 / (4096 * (double)4096);
+    double flag, h11 = 0, h12 = 0, h21 = 0, h22 = 0, p1, p2, q1, q2, u, temp;
+    if (*d1 < 0) {
+        flag = -1;
+        *d1 = 0;
+        *d2 = 0;
+        *b1 = 0;
+    } else {
+        p2 = *d2 * b2;
+        if (p2 == 0) {
+            P[0] = -2;
+            return;
+        }
+        p1 = *d1 * *b1;
+        q2 = p2 * b2;
+        q1 = p1 * *b1;
+        if (fabs(q1) > fabs(q2)) {
+            h21 = -b2 / *b1;
+            h12 = p2 / p1;
+            u = 1 - h12 * h21;
+            if (u > 0) {
+                flag = 0;
+                *d1 /= u;
+                *d2 /= u;
+                *b1 *= u;
+            } else {
+                flag = -1;
+                h11 = 0; h12 = 0; h21 = 0; h22 = 0;
+                *d1 = 0;
+                *d2 = 0;
+                *b1 = 0;
+            }
+        } else if (q2 < 0) {
+            flag = -1;
+            h11 = 0; h12 = 0; h21 = 0; h22 = 0;
+            *d1 = 0;
+            *d2 = 0;
+            *b1 = 0;
+        } else {
+            flag = 1;
+            h11 = p1 / p2;
+            h22 = *b1 / b2;
+            u = 1 + h11 * h22;
+            temp = *d2 / u;
+            *d2 = *d1 / u;
+            *d1 = temp;
+            *b1 = b2 * u;
+        }
+        if (*d1 != 0) {
+            while (*d1 <= rgamsq || *d1 >= gamsq) {
+                if (flag == 0) {
+                    h11 = 1;
+                    h22 = 1;
+                } else if (flag > 0) {
+                    h21 = -1;
+                    h12 = 1;
+                }
+                flag = -1;
+                if (*d1 <= rgamsq) {
+                    *d1 *= gamsq;
+                    *b1 /= gam;
+                    h11 /= gam;
+                    h12 /= gam;
+                } else {
+                    *d1 /= gamsq;
+                    *b1 *= gam;
+                    h11 *= gam;
+                    h12 *= gam;
+                }
+            }
+        }
+        if (*d2 != 0) {
+            while (fabs(*d2) <= rgamsq || fabs(*d2) >= gamsq) {
+                if (flag == 0) {
+                    h11 = 1;
+                    h22 = 1;
+                } else if (flag > 0) {
+                    h21 = -1;
+                    h12 = 1;
+                }
+                flag = -1;
+                if (fabs(*d2) <= rgamsq) {
+                    *d2 *= gamsq;
+                    h21 /= gam;
+                    h22 /= gam;
+                } else {
+                    *d2 /= gamsq;
+                    h21 *= gam;
+                    h22 *= gam;
+                }
+            }
+        }
+    }
+    P[0] = flag;
+    if (flag < 0) {
+        P[1] = h11; P[2] = h21; P[3] = h12; P[4] = h22;
+    } else if (flag == 0) {
+        P[2] = h21; P[3] = h12;
+    } else {
+        P[1] = h11; P[4] = h22;
+    }
+}
 
-void cblas_sscal(const int N, const float alpha, float *X, const int incX) {return;}
-void cblas_dscal(const int N, const double alpha, double *X, const int incX) {return;}
+void cblas_sscal(const int N, const float alpha, float *X, const int incX)
+{
+    int i;
+    if (incX == 1) {
+        float *FINDBLAS_MOCK_RESTRICT xx = X;
+        for (i = 0; i < N; i++)
+            xx[i] *= alpha;
+    } else {
+        int ix = findblas_mock_start(N, incX);
+        for (i = 0; i < N; i++, ix += incX)
+            X[ix] *= alpha;
+    }
+}
+void cblas_dscal(const int N, const double alpha, double *X, const int incX)
+{
+    int i;
+    if (incX == 1) {
+        double *FINDBLAS_MOCK_RESTRICT xx = X;
+        for (i = 0; i < N; i++)
+            xx[i] *= alpha;
+    } else {
+        int ix = findblas_mock_start(N, incX);
+        for (i = 0; i < N; i++, ix += incX)
+            X[ix] *= alpha;
+    }
+}
 void cblas_cscal(const int N, const float *alpha, float *X, const int incX) {return;}
 void cblas_zscal(const int N, const double *alpha, double *X, const int incX) {return;}
 void cblas_csscal(const int N, const float alpha, float *X, const int incX) {return;}
 void cblas_zdscal(const int N, const double alpha, double *X, const int incX) {return;}
 
 void cblas_sgemv(const enum CBLAS_ORDER order,  const enum CBLAS_TRANSPOSE trans,  const int m, const int n,
-		 const float alpha, const float  *a, const int lda,  const float  *x, const int incx,  const float beta,  float  *y, const int incy) {return;}
+		 const float alpha, const float  *a, const int lda,  const float  *x, const int incx,  const float beta,  float  *y, const int incy)
+{
+    const int rs = (order == CblasRowMajor)? lda : 1;
+    const int cs = (order == CblasRowMajor)? 1 : lda;
+    const int do_trans = (trans == CblasTrans) || (trans == CblasConjTrans);
+    const int xlen = do_trans? m : n;
+    const int ylen = do_trans? n : m;
+    const int ix0 = findblas_mock_start(xlen, incx);
+    const int iy0 = findblas_mock_start(ylen, incy);
+    float acc;
+    int i, j;
+    if (!do_trans) {
+        for (i = 0; i < m; i++) {
+            acc = 0;
+            for (j = 0; j < n; j++)
+                acc += a[i*rs + j*cs] * x[ix0 + j*incx];
+            y[iy0 + i*incy] = alpha * acc + ((beta == 0)? 0 : (beta * y[iy0 + i*incy]));
+        }
+    } else {
+        for (j = 0; j < n; j++) {
+            acc = 0;
+            for (i = 0; i < m; i++)
+                acc += a[i*rs + j*cs] * x[ix0 + i*incx];
+            y[iy0 + j*incy] = alpha * acc + ((beta == 0)? 0 : (beta * y[iy0 + j*incy]));
+        }
+    }
+}
 void cblas_dgemv(const enum CBLAS_ORDER order,  const enum CBLAS_TRANSPOSE trans,  const int m, const int n,
-		 const double alpha, const double  *a, const int lda,  const double  *x, const int incx,  const double beta,  double  *y, const int incy) {return;}
+		 const double alpha, const double  *a, const int lda,  const double  *x, const int incx,  const double beta,  double  *y, const int incy)
+{
+    const int rs = (order == CblasRowMajor)? lda : 1;
+    const int cs = (order == CblasRowMajor)? 1 : lda;
+    const int do_trans = (trans == CblasTrans) || (trans == CblasConjTrans);
+    const int xlen = do_trans? m : n;
+    const int ylen = do_trans? n : m;
+    const int ix0 = findblas_mock_start(xlen, incx);
+    const int iy0 = findblas_mock_start(ylen, incy);
+    double acc;
+    int i, j;
+    if (!do_trans) {
+        for (i = 0; i < m; i++) {
+            acc = 0;
+            for (j = 0; j < n; j++)
+                acc += a[i*rs + j*cs] * x[ix0 + j*incx];
+            y[iy0 + i*incy] = alpha * acc + ((beta == 0)? 0 : (beta * y[iy0 + i*incy]));
+        }
+    } else {
+        for (j = 0; j < n; j++) {
+            acc = 0;
+            for (i = 0; i < m; i++)
+                acc += a[i*rs + j*cs] * x[ix0 + i*incx];
+            y[iy0 + j*incy] = alpha * acc + ((beta == 0)? 0 : (beta * y[iy0 + j*incy]));
+        }
+    }
+}
 void cblas_cgemv(const enum CBLAS_ORDER order,  const enum CBLAS_TRANSPOSE trans,  const int m, const int n,
 		 const float *alpha, const float  *a, const int lda,  const float  *x, const int incx,  const float *beta,  float  *y, const int incy) {return;}
 void cblas_zgemv(const enum CBLAS_ORDER order,  const enum CBLAS_TRANSPOSE trans,  const int m, const int n,
 		 const double *alpha, const double  *a, const int lda,  const double  *x, const int incx,  const double *beta,  double  *y, const int incy) {return;}
 
-void cblas_sger (const enum CBLAS_ORDER order, const int M, const int N, const float   alpha, const float  *X, const int incX, const float  *Y, const int incY, float  *A, const int lda) {return;}
-void cblas_dger (const enum CBLAS_ORDER order, const int M, const int N, const double  alpha, const double *X, const int incX, const double *Y, const int incY, double *A, const int lda) {return;}
+void cblas_sger (const enum CBLAS_ORDER order, const int M, const int N, const float   alpha, const float  *X, const int incX, const float  *Y, const int incY, float  *A, const int lda)
+{
+    const int rs = (order == CblasRowMajor)? lda : 1;
+    const int cs = (order == CblasRowMajor)? 1 : lda;
+    const int ix0 = findblas_mock_start(M, incX);
+    const int iy0 = findblas_mock_start(N, incY);
+    float xv;
+    int i, j;
+    for (i = 0; i < M; i++) {
+        xv = alpha * X[ix0 + i*incX];
+        for (j = 0; j < N; j++)
+            A[i*rs + j*cs] += xv * Y[iy0 + j*incY];
+    }
+}
+void cblas_dger (const enum CBLAS_ORDER order, const int M, const int N, const double  alpha, const double *X, const int incX, const double *Y, const int incY, double *A, const int lda)
+{
+    const int rs = (order == CblasRowMajor)? lda : 1;
+    const int cs = (order == CblasRowMajor)? 1 : lda;
+    const int ix0 = findblas_mock_start(M, incX);
+    const int iy0 = findblas_mock_start(N, incY);
+    double xv;
+    int i, j;
+    for (i = 0; i < M; i++) {
+        xv = alpha * X[ix0 + i*incX];
+        for (j = 0; j < N; j++)
+            A[i*rs + j*cs] += xv * Y[iy0 + j*incY];
+    }
+}
 void cblas_cgeru(const enum CBLAS_ORDER order, const int M, const int N, const float  *alpha, const float  *X, const int incX, const float  *Y, const int incY, float  *A, const int lda) {return;}
 void cblas_cgerc(const enum CBLAS_ORDER order, const int M, const int N, const float  *alpha, const float  *X, const int incX, const float  *Y, const int incY, float  *A, const int lda) {return;}
 void cblas_zgeru(const enum CBLAS_ORDER order, const int M, const int N, const double *alpha, const double *X, const int incX, const double *Y, const int incY, double *A, const int lda) {return;}
@@ -249,9 +882,77 @@ void cblas_zhpmv(const enum CBLAS_ORDER order, const enum CBLAS_UPLO Uplo, const
 		 const double *alpha, const double *Ap, const double *X, const int incX, const double *beta, double *Y, const int incY) {return;}
 
 void cblas_sgemm(const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_TRANSPOSE TransB, const int M, const int N, const int K,
-		 const float alpha, const float *A, const int lda, const float *B, const int ldb, const float beta, float *C, const int ldc) {return;}
+		 const float alpha, const float *A, const int lda, const float *B, const int ldb, const float beta, float *C, const int ldc)
+{
+    const int rm = (Order == CblasRowMajor);
+    const int ta = (TransA == CblasTrans) || (TransA == CblasConjTrans);
+    const int tb = (TransB == CblasTrans) || (TransB == CblasConjTrans);
+    /* strides of op(A)[i,l], op(B)[l,j], C[i,j] over the raw arrays */
+    const int a_i = ta? (rm? 1 : lda) : (rm? lda : 1);
+    const int a_l = ta? (rm? lda : 1) : (rm? 1 : lda);
+    const int b_l = tb? (rm? 1 : ldb) : (rm? ldb : 1);
+    const int b_j = tb? (rm? ldb : 1) : (rm? 1 : ldb);
+    const int c_i = rm? ldc : 1;
+    const int c_j = rm? 1 : ldc;
+    float bv;
+    int i, j, l, ii, jj, ll, i_end, j_end, l_end;
+    for (j = 0; j < N; j++)
+        for (i = 0; i < M; i++)
+            C[i*c_i + j*c_j] = (beta == 0)? 0 : (beta * C[i*c_i + j*c_j]);
+    if (alpha == 0)
+        return;
+    for (jj = 0; jj < N; jj += FINDBLAS_MOCK_TILE) {
+        j_end = (jj + FINDBLAS_MOCK_TILE < N)? (jj + FINDBLAS_MOCK_TILE) : N;
+        for (ll = 0; ll < K; ll += FINDBLAS_MOCK_TILE) {
+            l_end = (ll + FINDBLAS_MOCK_TILE < K)? (ll + FINDBLAS_MOCK_TILE) : K;
+            for (ii = 0; ii < M; ii += FINDBLAS_MOCK_TILE) {
+                i_end = (ii + FINDBLAS_MOCK_TILE < M)? (ii + FINDBLAS_MOCK_TILE) : M;
+                for (j = jj; j < j_end; j++)
+                    for (l = ll; l < l_end; l++) {
+                        bv = alpha * B[l*b_l + j*b_j];
+                        for (i = ii; i < i_end; i++)
+                            C[i*c_i + j*c_j] += bv * A[i*a_i + l*a_l];
+                    }
+            }
+        }
+    }
+}
 void cblas_dgemm(const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_TRANSPOSE TransB, const int M, const int N, const int K,
-		 const double alpha, const double *A, const int lda, const double *B, const int ldb, const double beta, double *C, const int ldc) {return;}
+		 const double alpha, const double *A, const int lda, const double *B, const int ldb, const double beta, double *C, const int ldc)
+{
+    const int rm = (Order == CblasRowMajor);
+    const int ta = (TransA == CblasTrans) || (TransA == CblasConjTrans);
+    const int tb = (TransB == CblasTrans) || (TransB == CblasConjTrans);
+    /* strides of op(A)[i,l], op(B)[l,j], C[i,j] over the raw arrays */
+    const int a_i = ta? (rm? 1 : lda) : (rm? lda : 1);
+    const int a_l = ta? (rm? lda : 1) : (rm? 1 : lda);
+    const int b_l = tb? (rm? 1 : ldb) : (rm? ldb : 1);
+    const int b_j = tb? (rm? ldb : 1) : (rm? 1 : ldb);
+    const int c_i = rm? ldc : 1;
+    const int c_j = rm? 1 : ldc;
+    double bv;
+    int i, j, l, ii, jj, ll, i_end, j_end, l_end;
+    for (j = 0; j < N; j++)
+        for (i = 0; i < M; i++)
+            C[i*c_i + j*c_j] = (beta == 0)? 0 : (beta * C[i*c_i + j*c_j]);
+    if (alpha == 0)
+        return;
+    for (jj = 0; jj < N; jj += FINDBLAS_MOCK_TILE) {
+        j_end = (jj + FINDBLAS_MOCK_TILE < N)? (jj + FINDBLAS_MOCK_TILE) : N;
+        for (ll = 0; ll < K; ll += FINDBLAS_MOCK_TILE) {
+            l_end = (ll + FINDBLAS_MOCK_TILE < K)? (ll + FINDBLAS_MOCK_TILE) : K;
+            for (ii = 0; ii < M; ii += FINDBLAS_MOCK_TILE) {
+                i_end = (ii + FINDBLAS_MOCK_TILE < M)? (ii + FINDBLAS_MOCK_TILE) : M;
+                for (j = jj; j < j_end; j++)
+                    for (l = ll; l < l_end; l++) {
+                        bv = alpha * B[l*b_l + j*b_j];
+                        for (i = ii; i < i_end; i++)
+                            C[i*c_i + j*c_j] += bv * A[i*a_i + l*a_l];
+                    }
+            }
+        }
+    }
+}
 void cblas_cgemm(const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_TRANSPOSE TransB, const int M, const int N, const int K,
 		 const float *alpha, const float *A, const int lda, const float *B, const int ldb, const float *beta, float *C, const int ldc) {return;}
 void cblas_cgemm3m(const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA, const enum CBLAS_TRANSPOSE TransB, const int M, const int N, const int K,
@@ -272,9 +973,53 @@ void cblas_zsymm(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side, const
                  const double *alpha, const double *A, const int lda, const double *B, const int ldb, const double *beta, double *C, const int ldc) {return;}
 
 void cblas_ssyrk(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans,
-		 const int N, const int K, const float alpha, const float *A, const int lda, const float beta, float *C, const int ldc) {return;}
+		 const int N, const int K, const float alpha, const float *A, const int lda, const float beta, float *C, const int ldc)
+{
+    const int rm = (Order == CblasRowMajor);
+    const int tr = (Trans == CblasTrans) || (Trans == CblasConjTrans);
+    const int upper = (Uplo == CblasUpper);
+    /* strides of op(A)[i,l] (the n-by-k factor) and C[i,j] over the raw arrays */
+    const int a_i = tr? (rm? 1 : lda) : (rm? lda : 1);
+    const int a_l = tr? (rm? lda : 1) : (rm? 1 : lda);
+    const int c_i = rm? ldc : 1;
+    const int c_j = rm? 1 : ldc;
+    float acc;
+    int i, j, l, j0, j1;
+    for (i = 0; i < N; i++) {
+        j0 = upper? i : 0;
+        j1 = upper? N : (i + 1);
+        for (j = j0; j < j1; j++) {
+            acc = 0;
+            for (l = 0; l < K; l++)
+                acc += A[i*a_i + l*a_l] * A[j*a_i + l*a_l];
+            C[i*c_i + j*c_j] = alpha * acc + ((beta == 0)? 0 : (beta * C[i*c_i + j*c_j]));
+        }
+    }
+}
 void cblas_dsyrk(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans,
-		 const int N, const int K, const double alpha, const double *A, const int lda, const double beta, double *C, const int ldc) {return;}
+		 const int N, const int K, const double alpha, const double *A, const int lda, const double beta, double *C, const int ldc)
+{
+    const int rm = (Order == CblasRowMajor);
+    const int tr = (Trans == CblasTrans) || (Trans == CblasConjTrans);
+    const int upper = (Uplo == CblasUpper);
+    /* strides of op(A)[i,l] (the n-by-k factor) and C[i,j] over the raw arrays */
+    const int a_i = tr? (rm? 1 : lda) : (rm? lda : 1);
+    const int a_l = tr? (rm? lda : 1) : (rm? 1 : lda);
+    const int c_i = rm? ldc : 1;
+    const int c_j = rm? 1 : ldc;
+    double acc;
+    int i, j, l, j0, j1;
+    for (i = 0; i < N; i++) {
+        j0 = upper? i : 0;
+        j1 = upper? N : (i + 1);
+        for (j = j0; j < j1; j++) {
+            acc = 0;
+            for (l = 0; l < K; l++)
+                acc += A[i*a_i + l*a_l] * A[j*a_i + l*a_l];
+            C[i*c_i + j*c_j] = alpha * acc + ((beta == 0)? 0 : (beta * C[i*c_i + j*c_j]));
+        }
+    }
+}
 void cblas_csyrk(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans,
 		 const int N, const int K, const float *alpha, const float *A, const int lda, const float *beta, float *C, const int ldc) {return;}
 void cblas_zsyrk(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE Trans,
@@ -10,6 +10,22 @@ setup(
     author="David Cortes",
     url="https://github.com/david-cortes/findblas",
     classifiers=[],
-    data_files=[("include", ["findblas/findblas.h", "findblas/rtd_mock.c"])],
+    data_files=[
+        (
+            "include",
+            [
+                "findblas/findblas.h",
+                "findblas/findblas_common.h",
+                "findblas/findblas_level1.h",
+                "findblas/findblas_level2.h",
+                "findblas/findblas_level3.h",
+                "findblas/findblas_ext.h",
+                "findblas/findblas_dispatch.h",
+                "findblas/findblas_fortran.h",
+                "findblas/findlapack.h",
+                "findblas/rtd_mock.c",
+            ],
+        )
+    ],
     include_package_data=True,
 )